@@ -104,4 +104,77 @@ public:
 	}
 };
 #endif
+
+namespace SteamCore
+{
+	/** Unsigned LEB128 varint, 7 bits per byte with the high bit set on every byte but the last */
+	inline void WriteVarUInt(FNboSerializeToBuffer& Ar, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Ar << static_cast<uint8>((Value & 0x7F) | 0x80);
+			Value >>= 7;
+		}
+		Ar << static_cast<uint8>(Value);
+	}
+
+	/** Zigzag encoded so small negative values stay small */
+	inline void WriteVarInt(FNboSerializeToBuffer& Ar, int64 Value)
+	{
+		WriteVarUInt(Ar, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	/** UTF-8 bytes prefixed by a varint length, without the terminator */
+	inline void WriteCompactString(FNboSerializeToBuffer& Ar, const FString& Value)
+	{
+		const FTCHARToUTF8 Converted(*Value);
+		WriteVarUInt(Ar, Converted.Length());
+		Ar.WriteBinary(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	inline uint64 ReadVarUInt(FNboSerializeFromBuffer& Ar)
+	{
+		uint64 Value = 0;
+		for (int32 Shift = 0; Shift < 64 && !Ar.HasOverflow(); Shift += 7)
+		{
+			uint8 Byte = 0;
+			Ar >> Byte;
+			Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				break;
+			}
+		}
+		return Value;
+	}
+
+	inline int64 ReadVarInt(FNboSerializeFromBuffer& Ar)
+	{
+		const uint64 Encoded = ReadVarUInt(Ar);
+		return static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+	}
+
+	/** Returns false if the string is longer than MaxLength or runs past the end of the buffer */
+	inline bool ReadCompactString(FNboSerializeFromBuffer& Ar, FString& OutValue, uint32 MaxLength = 1024)
+	{
+		const uint64 Length = ReadVarUInt(Ar);
+		if (Ar.HasOverflow() || Length > MaxLength)
+		{
+			return false;
+		}
+
+		TArray<uint8, TInlineAllocator<128>> Bytes;
+		Bytes.SetNumUninitialized(static_cast<int32>(Length));
+		Ar.ReadBinary(Bytes.GetData(), static_cast<uint32>(Length));
+		if (Ar.HasOverflow())
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+		OutValue = FString(Converted.Length(), Converted.Get());
+		return true;
+	}
+}
+
 #endif
\ No newline at end of file
@@ -295,6 +295,17 @@ void FOnlineSubsystemSteamCore::QueueAsyncTask(FOnlineAsyncTask* AsyncTask)
 	m_OnlineAsyncTaskThreadRunnable->AddToInQueue(AsyncTask);
 }
 
+uint32 FOnlineSubsystemSteamCore::ScheduleAsyncTask(FOnlineAsyncTask* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority, TFunction<void()> OnCancelled)
+{
+	check(m_OnlineAsyncTaskThreadRunnable);
+	return m_OnlineAsyncTaskThreadRunnable->AddToScheduler(AsyncTask, Category, Priority, MoveTemp(OnCancelled));
+}
+
+bool FOnlineSubsystemSteamCore::CancelAsyncTask(uint32 Handle)
+{
+	return m_OnlineAsyncTaskThreadRunnable ? m_OnlineAsyncTaskThreadRunnable->CancelScheduledTask(Handle) : false;
+}
+
 void FOnlineSubsystemSteamCore::QueueAsyncOutgoingItem(FOnlineAsyncItem* AsyncItem)
 {
 	check(m_OnlineAsyncTaskThreadRunnable);
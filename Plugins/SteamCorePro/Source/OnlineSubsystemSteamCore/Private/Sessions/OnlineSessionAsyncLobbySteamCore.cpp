@@ -344,7 +344,7 @@ FString FOnlineAsyncTaskSteamCoreJoinLobby::ToString() const
 
 FString FOnlineAsyncTaskSteamCoreUpdateLobby::ToString() const
 {
-	return FString::Printf(TEXT("FOnlineAsyncTaskSteamCoreUpdateLobby bWasSuccessful: %d Session: %s"), WasSuccessful(), *m_SessionName.ToString());
+	return FString::Printf(TEXT("FOnlineAsyncTaskSteamCoreUpdateLobby bWasSuccessful: %d Session: %s Updates: %d"), WasSuccessful(), *m_SessionName.ToString(), m_NumCoalescedUpdates);
 }
 
 void FOnlineAsyncTaskSteamCoreUpdateLobby::Tick()
@@ -384,7 +384,7 @@ void FOnlineAsyncTaskSteamCoreUpdateLobby::Tick()
 						const int32 LobbyMemberCount = SteamMatchmakingPtr->GetNumLobbyMembers(*SessionInfo->m_SessionId);
 						const int32 NumConnections = Session->SessionSettings.NumPrivateConnections + Session->SessionSettings.NumPublicConnections;
 
-						if (SteamMatchmakingPtr->SetLobbyMemberLimit(*SessionInfo->m_SessionId, NumConnections))
+						if (SteamMatchmakingPtr->GetLobbyMemberLimit(*SessionInfo->m_SessionId) == NumConnections || SteamMatchmakingPtr->SetLobbyMemberLimit(*SessionInfo->m_SessionId, NumConnections))
 						{
 							const int32 MaxLobbyMembers = SteamMatchmakingPtr->GetLobbyMemberLimit(*SessionInfo->m_SessionId);
 							const bool bLobbyJoinable = Session->SessionSettings.bAllowJoinInProgress && (MaxLobbyMembers != 0);
@@ -395,9 +395,18 @@ void FOnlineAsyncTaskSteamCoreUpdateLobby::Tick()
 								FSteamSessionKeyValuePairs KeyValuePairs;
 								GetLobbyKeyValuePairsFromSession(Session, KeyValuePairs);
 
+								// Every SetLobbyData call is broadcast to all members, so only keys that were removed or changed are touched.
+								// The lobby's own copy of the data is compared against rather than the old settings, which may never have been published
+								int32 NumKeysTouched = 0;
 								for (FSteamSessionKeyValuePairs::TConstIterator It(OldKeyValuePairs); It; ++It)
 								{
+									if (KeyValuePairs.Contains(It.Key()) || *SteamMatchmakingPtr->GetLobbyData(*SessionInfo->m_SessionId, TCHAR_TO_UTF8(*It.Key())) == '\0')
+									{
+										continue;
+									}
+
 									LogSteamCoreVerbose("Removing Lobby Data (%s, %s)", *It.Key(), *It.Value());
+									NumKeysTouched++;
 									if (!SteamMatchmakingPtr->SetLobbyData(*SessionInfo->m_SessionId, TCHAR_TO_UTF8(*It.Key()), ""))
 									{
 										bWasSuccessful = false;
@@ -409,7 +418,14 @@ void FOnlineAsyncTaskSteamCoreUpdateLobby::Tick()
 								{
 									for (FSteamSessionKeyValuePairs::TConstIterator It(KeyValuePairs); It; ++It)
 									{
+										const FString CurrentValue(UTF8_TO_TCHAR(SteamMatchmakingPtr->GetLobbyData(*SessionInfo->m_SessionId, TCHAR_TO_UTF8(*It.Key()))));
+										if (CurrentValue.Equals(It.Value(), ESearchCase::CaseSensitive))
+										{
+											continue;
+										}
+
 										LogSteamCoreVerbose("Updating Lobby Data (%s, %s)", *It.Key(), *It.Value());
+										NumKeysTouched++;
 										if (!SteamMatchmakingPtr->SetLobbyData(*SessionInfo->m_SessionId, TCHAR_TO_UTF8(*It.Key()), TCHAR_TO_UTF8(*It.Value())))
 										{
 											bWasSuccessful = false;
@@ -417,6 +433,8 @@ void FOnlineAsyncTaskSteamCoreUpdateLobby::Tick()
 										}
 									}
 								}
+
+								LogSteamCoreVerbose("Lobby update for %s touched %d keys of %d", *m_SessionName.ToString(), NumKeysTouched, KeyValuePairs.Num());
 							}
 						}
 					}
@@ -438,7 +456,10 @@ void FOnlineAsyncTaskSteamCoreUpdateLobby::TriggerDelegates()
 	const IOnlineSessionPtr SessionInt = Subsystem->GetSessionInterface();
 	if (SessionInt.IsValid())
 	{
-		SessionInt->TriggerOnUpdateSessionCompleteDelegates(m_SessionName, bWasSuccessful);
+		for (int32 UpdateIdx = 0; UpdateIdx < m_NumCoalescedUpdates; UpdateIdx++)
+		{
+			SessionInt->TriggerOnUpdateSessionCompleteDelegates(m_SessionName, bWasSuccessful);
+		}
 	}
 }
 
@@ -561,6 +582,12 @@ void FOnlineAsyncTaskSteamCoreFindLobbiesBase::CreateQuery()
 			continue;
 		}
 
+		// Options for the search task itself, not lobby data
+		if (Key == SEARCH_STEAM_STREAM_RESULTS || Key == SEARCH_STEAM_EARLY_COMPLETE_RESULTS || Key == SEARCH_STEAM_SOFT_TIMEOUT)
+		{
+			continue;
+		}
+
 		FString KeyStr;
 		if (SessionKeyToSteamKey(Key, SearchParam.Data, KeyStr))
 		{
@@ -625,6 +652,26 @@ void FOnlineAsyncTaskSteamCoreFindLobbiesBase::CreateQuery()
 	}
 }
 
+void FOnlineAsyncTaskSteamCoreFindLobbiesBase::InitStreaming()
+{
+	const FOnlineSearchSettings& QuerySettings = m_SearchSettings->QuerySettings;
+	QuerySettings.Get(SEARCH_STEAM_STREAM_RESULTS, m_bStreamResults);
+
+	if (!m_bStreamResults)
+	{
+		return;
+	}
+
+	QuerySettings.Get(SEARCH_STEAM_EARLY_COMPLETE_RESULTS, m_EarlyCompleteResults);
+
+	// Without a soft deadline the search waits for every lobby up to ASYNC_TASK_TIMEOUT like a regular search
+	float SoftTimeout = 0.0f;
+	if (QuerySettings.Get(SEARCH_STEAM_SOFT_TIMEOUT, SoftTimeout) && SoftTimeout > 0.0f)
+	{
+		m_SoftTimeout = FMath::Min(SoftTimeout, ASYNC_TASK_TIMEOUT);
+	}
+}
+
 void FOnlineAsyncTaskSteamCoreFindLobbiesBase::ParseSearchResult(const FUniqueNetIdSteam& LobbyId) const
 {
 	LogSteamCoreVerbose("");
@@ -730,15 +777,25 @@ void FOnlineAsyncTaskSteamCoreFindLobbiesBase::Tick()
 	case EFindLobbiesState::WaitForRequestLobbyData:
 		{
 			const FOnlineSessionSteamCorePtr SessionInt = StaticCastSharedPtr<FOnlineSessionSteamCore>(Subsystem->GetSessionInterface());
+			const int32 NumStreamedResults = m_bStreamResults ? SessionInt->m_NumStreamedSearchResults.GetValue() : 0;
 
-			if (m_LobbyIDs.Num() == SessionInt->m_PendingSearchLobbyIds.Num())
+			if (m_LobbyIDs.Num() <= SessionInt->m_PendingSearchLobbyIds.Num())
 			{
 				m_FindLobbiesState = EFindLobbiesState::Finished;
 			}
-
+			else if (m_EarlyCompleteResults > 0 && NumStreamedResults >= m_EarlyCompleteResults)
+			{
+				LogSteamCoreVerbose("Lobby search reached %d results, completing early", NumStreamedResults);
+				m_FindLobbiesState = EFindLobbiesState::Finished;
+			}
+			else if (NumStreamedResults > 0 && GetElapsedTime() >= m_SoftTimeout)
+			{
+				LogSteamCoreVerbose("Lobby search soft deadline reached with %d of %d lobbies parsed", NumStreamedResults, m_LobbyIDs.Num());
+				m_FindLobbiesState = EFindLobbiesState::Finished;
+			}
 			else if (GetElapsedTime() >= ASYNC_TASK_TIMEOUT)
 			{
-				bWasSuccessful = false;
+				bWasSuccessful = NumStreamedResults > 0;
 				m_FindLobbiesState = EFindLobbiesState::Finished;
 			}
 			break;
@@ -763,9 +820,9 @@ void FOnlineAsyncTaskSteamCoreFindLobbiesBase::Finalize()
 	LogSteamCoreVerbose("");
 	const FOnlineSessionSteamCorePtr SessionInt = StaticCastSharedPtr<FOnlineSessionSteamCore>(Subsystem->GetSessionInterface());
 
-	LogSteamCoreVerbose("Found %d lobbies, finalizing the search", SessionInt->m_PendingSearchLobbyIds.Num());
+	LogSteamCoreVerbose("Found %d lobbies, finalizing the search", m_bStreamResults ? SessionInt->m_NumStreamedSearchResults.GetValue() : SessionInt->m_PendingSearchLobbyIds.Num());
 
-	if (bWasSuccessful)
+	if (bWasSuccessful && !m_bStreamResults)
 	{
 		for (int32 LobbyIdx = 0; LobbyIdx < SessionInt->m_PendingSearchLobbyIds.Num(); LobbyIdx++)
 		{
@@ -782,10 +839,11 @@ void FOnlineAsyncTaskSteamCoreFindLobbiesBase::Finalize()
 			}
 		}
 
-		if (m_SearchSettings->SearchResults.Num() > 0)
-		{
-			m_SearchSettings->SortSearchResults();
-		}
+	}
+
+	if (bWasSuccessful && m_SearchSettings->SearchResults.Num() > 0)
+	{
+		m_SearchSettings->SortSearchResults();
 	}
 
 	m_SearchSettings->SearchState = bWasSuccessful ? EOnlineAsyncTaskState::Done : EOnlineAsyncTaskState::Failed;
@@ -795,6 +853,7 @@ void FOnlineAsyncTaskSteamCoreFindLobbiesBase::Finalize()
 	}
 
 	SessionInt->m_PendingSearchLobbyIds.Empty();
+	SessionInt->m_bStreamingLobbySearch = false;
 }
 
 FString FOnlineAsyncTaskSteamCoreFindLobbies::ToString() const
@@ -269,8 +269,7 @@ bool FOnlineSessionSteamCore::UpdateSession(FName SessionName, FOnlineSessionSet
 			{
 				if (SessionInfo->m_SessionType == ESteamSession::LobbySession && SessionInfo->m_SessionId->IsValid())
 				{
-					FOnlineAsyncTaskSteamCoreUpdateLobby* NewTask = new FOnlineAsyncTaskSteamCoreUpdateLobby(m_SteamSubsystem, SessionName, bShouldRefreshOnlineData, UpdatedSessionSettings);
-					m_SteamSubsystem->QueueAsyncTask(NewTask);
+					QueueLobbyUpdate(SessionName, UpdatedSessionSettings, bShouldRefreshOnlineData);
 				}
 				else if (SessionInfo->m_SessionType == ESteamSession::AdvertisedSessionHost)
 				{
@@ -286,6 +285,7 @@ bool FOnlineSessionSteamCore::UpdateSession(FName SessionName, FOnlineSessionSet
 		else
 		{
 			Session->SessionSettings = UpdatedSessionSettings;
+			InvalidateLanAdvertisement(SessionName);
 			TriggerOnUpdateSessionCompleteDelegates(SessionName, bWasSuccessful);
 		}
 	}
@@ -293,6 +293,55 @@ bool FOnlineSessionSteamCore::UpdateSession(FName SessionName, FOnlineSessionSet
 	return bWasSuccessful;
 }
 
+void FOnlineSessionSteamCore::QueueLobbyUpdate(FName SessionName, const FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData)
+{
+	LogSteamCoreVerbose("");
+
+	if (FPendingLobbyUpdate* PendingUpdate = m_PendingLobbyUpdates.Find(SessionName))
+	{
+		PendingUpdate->m_Settings = UpdatedSessionSettings;
+		PendingUpdate->m_bUpdateOnlineData |= bShouldRefreshOnlineData;
+		PendingUpdate->m_NumUpdates++;
+		return;
+	}
+
+	float CoalesceWindow = 0.25f;
+	GConfig->GetFloat(TEXT("OnlineSubsystemSteamCore"), TEXT("LobbyUpdateCoalesceWindow"), CoalesceWindow, GEngineIni);
+
+	// The first update after a quiet period goes out right away, later ones inside the window wait for it to end and go out as one
+	const double Now = FPlatformTime::Seconds();
+	const double* LastUpdateTime = m_LastLobbyUpdateTimes.Find(SessionName);
+	if (CoalesceWindow <= 0.0f || !LastUpdateTime || Now - *LastUpdateTime >= CoalesceWindow)
+	{
+		m_LastLobbyUpdateTimes.Add(SessionName, Now);
+
+		FOnlineAsyncTaskSteamCoreUpdateLobby* NewTask = new FOnlineAsyncTaskSteamCoreUpdateLobby(m_SteamSubsystem, SessionName, bShouldRefreshOnlineData, UpdatedSessionSettings);
+		m_SteamSubsystem->QueueAsyncTask(NewTask);
+		return;
+	}
+
+	FPendingLobbyUpdate& NewUpdate = m_PendingLobbyUpdates.Add(SessionName);
+	NewUpdate.m_Settings = UpdatedSessionSettings;
+	NewUpdate.m_bUpdateOnlineData = bShouldRefreshOnlineData;
+	NewUpdate.m_NumUpdates = 1;
+	NewUpdate.m_FlushTime = *LastUpdateTime + CoalesceWindow;
+}
+
+void FOnlineSessionSteamCore::CancelPendingLobbyUpdate(FName SessionName)
+{
+	FPendingLobbyUpdate PendingUpdate;
+	if (m_PendingLobbyUpdates.RemoveAndCopyValue(SessionName, PendingUpdate))
+	{
+		LogSteamCoreVerbose("Dropping %d pending lobby updates for session %s", PendingUpdate.m_NumUpdates, *SessionName.ToString());
+		for (int32 UpdateIdx = 0; UpdateIdx < PendingUpdate.m_NumUpdates; UpdateIdx++)
+		{
+			TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
+		}
+	}
+
+	m_LastLobbyUpdateTimes.Remove(SessionName);
+}
+
 bool FOnlineSessionSteamCore::EndSession(FName SessionName)
 {
 	LogSteamCoreVerbose("");
@@ -371,6 +420,8 @@ bool FOnlineSessionSteamCore::DestroySession(FName SessionName, const FOnDestroy
 	{
 		if (Session->SessionState != EOnlineSessionState::Destroying)
 		{
+			CancelPendingLobbyUpdate(SessionName);
+
 			if (!Session->SessionSettings.bIsLANMatch)
 			{
 				if (Session->SessionState == EOnlineSessionState::InProgress)
@@ -555,6 +606,8 @@ uint32 FOnlineSessionSteamCore::FindInternetSession(const TSharedRef<FOnlineSess
 	if (SearchSettings->QuerySettings.Get(SEARCH_PRESENCE, PresenceSearch) && PresenceSearch)
 	{
 		FOnlineAsyncTaskSteamCoreFindLobbies* NewTask = new FOnlineAsyncTaskSteamCoreFindLobbies(m_SteamSubsystem, SearchSettings);
+		m_bStreamingLobbySearch = NewTask->IsStreamingResults();
+		m_NumStreamedSearchResults.Reset();
 		m_SteamSubsystem->QueueAsyncTask(NewTask);
 	}
 	else
@@ -566,6 +619,42 @@ uint32 FOnlineSessionSteamCore::FindInternetSession(const TSharedRef<FOnlineSess
 	return ONLINE_IO_PENDING;
 }
 
+void FOnlineSessionSteamCore::OnSearchLobbyDataReceived(const FUniqueNetIdSteamRef& LobbyId)
+{
+	if (m_PendingSearchLobbyIds.ContainsByPredicate([&LobbyId](const FUniqueNetIdSteamRef& PendingId) { return *PendingId == *LobbyId; }))
+	{
+		return;
+	}
+
+	m_PendingSearchLobbyIds.Add(LobbyId);
+
+	if (!m_bStreamingLobbySearch || !m_CurrentSessionSearch.IsValid() || IsMemberOfLobby(*LobbyId))
+	{
+		return;
+	}
+
+	if (!LobbyId->IsValid() || !(**LobbyId).IsLobby())
+	{
+		LogSteamCoreWarn("Lobby %s is invalid (or not a lobby), skipping.", *LobbyId->ToDebugString());
+		return;
+	}
+
+	FOnlineSessionSearchResult* NewSearchResult = new(m_CurrentSessionSearch->SearchResults) FOnlineSessionSearchResult();
+	if (!SteamCore::FillSessionFromLobbyData(m_SteamSubsystem, *LobbyId, NewSearchResult->Session, NewSearchResult))
+	{
+		LogSteamCoreWarn("Unable to parse search result for lobby '%s'", *LobbyId->ToDebugString());
+		m_CurrentSessionSearch->SearchResults.RemoveAt(m_CurrentSessionSearch->SearchResults.Num() - 1, 1, EAllowShrinking::No);
+		return;
+	}
+
+	m_NumStreamedSearchResults.Increment();
+	LogSteamCoreVerbose("Streamed search result %d: LobbyId=%s", m_CurrentSessionSearch->SearchResults.Num() - 1, *LobbyId->ToDebugString());
+
+	// Listeners may start another search or add results, either of which can reallocate SearchResults under a reference
+	const FOnlineSessionSearchResult SearchResult = m_CurrentSessionSearch->SearchResults.Last();
+	TriggerOnLobbySearchResultReceivedDelegates(SearchResult);
+}
+
 uint32 FOnlineSessionSteamCore::FindLANSession(const TSharedRef<FOnlineSessionSearch>& SearchSettings)
 {
 	LogSteamCoreVerbose("");
@@ -1138,6 +1227,8 @@ FOnlineSessionSettings* FOnlineSessionSteamCore::GetSessionSettings(FName Sessio
 	FNamedOnlineSession* Session = GetNamedSession(SessionName);
 	if (Session)
 	{
+		// The caller may change the settings through the pointer
+		InvalidateLanAdvertisement(SessionName);
 		return &Session->SessionSettings;
 	}
 	return nullptr;
@@ -1316,6 +1407,7 @@ void FOnlineSessionSteamCore::Tick(float DeltaTime)
 	SCOPE_CYCLE_COUNTER(STAT_Session_Interface);
 	TickLanTasks(DeltaTime);
 	TickPendingInvites(DeltaTime);
+	TickPendingLobbyUpdates(DeltaTime);
 }
 
 void FOnlineSessionSteamCore::TickLanTasks(float DeltaTime) const
@@ -1353,13 +1445,116 @@ void FOnlineSessionSteamCore::TickPendingInvites(float DeltaTime)
 	}
 }
 
+void FOnlineSessionSteamCore::TickPendingLobbyUpdates(float DeltaTime)
+{
+	if (m_PendingLobbyUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (TMap<FName, FPendingLobbyUpdate>::TIterator It(m_PendingLobbyUpdates); It; ++It)
+	{
+		FPendingLobbyUpdate& PendingUpdate = It.Value();
+		if (Now < PendingUpdate.m_FlushTime)
+		{
+			continue;
+		}
+
+		LogSteamCoreVerbose("Flushing %d coalesced lobby updates for session %s", PendingUpdate.m_NumUpdates, *It.Key().ToString());
+		m_LastLobbyUpdateTimes.Add(It.Key(), Now);
+
+		FOnlineAsyncTaskSteamCoreUpdateLobby* NewTask = new FOnlineAsyncTaskSteamCoreUpdateLobby(m_SteamSubsystem, It.Key(), PendingUpdate.m_bUpdateOnlineData, PendingUpdate.m_Settings, PendingUpdate.m_NumUpdates);
+		m_SteamSubsystem->QueueAsyncTask(NewTask);
+		It.RemoveCurrent();
+	}
+}
+
+/**
+* LAN advertisements use their own compact layout after the beacon header: the ten session booleans are packed into one
+* varint, counts are varints and setting keys known to both sides are sent as an index into GetLanKeyDictionary.
+* Bump LAN_ADVERTISEMENT_VERSION whenever the layout changes, peers drop advertisements of another version.
+*/
+#define LAN_ADVERTISEMENT_VERSION 2
+#define LAN_ADVERTISEMENT_MAX_AGE 1.0
+
+enum ELanSessionFlags : uint16
+{
+	LanFlag_ShouldAdvertise = 1 << 0,
+	LanFlag_IsLANMatch = 1 << 1,
+	LanFlag_IsDedicated = 1 << 2,
+	LanFlag_UsesStats = 1 << 3,
+	LanFlag_AllowJoinInProgress = 1 << 4,
+	LanFlag_AllowInvites = 1 << 5,
+	LanFlag_UsesPresence = 1 << 6,
+	LanFlag_AllowJoinViaPresence = 1 << 7,
+	LanFlag_AllowJoinViaPresenceFriendsOnly = 1 << 8,
+	LanFlag_AntiCheatProtected = 1 << 9
+};
+
+/** Each setting starts with one byte holding its data type, advertisement type, bool value and whether the key is a dictionary index */
+enum ELanSettingHeader : uint8
+{
+	LanSetting_TypeMask = 0x0F,
+	LanSetting_AdvertisementShift = 4,
+	LanSetting_AdvertisementMask = 0x30,
+	LanSetting_BoolValue = 0x40,
+	LanSetting_DictionaryKey = 0x80
+};
+
+/** Keys sent as an index instead of a string. Games append their own with +LanAdvertisementKeys, hosts and clients must agree on the list */
+static const TArray<FName>& GetLanKeyDictionary()
+{
+	static const TArray<FName> Dictionary = []()
+	{
+		TArray<FName> Keys = {
+			SETTING_MAPNAME, SETTING_GAMEMODE, SETTING_NUMBOTS, SETTING_BEACONPORT, SETTING_QOS, SETTING_REGION,
+			SETTING_MATCHING_HOPPER, SETTING_MATCHING_TIMEOUT, SETTING_SESSION_TEMPLATE_NAME, SEARCH_KEYWORDS,
+			SETTING_CUSTOMSEARCHINT1, SETTING_CUSTOMSEARCHINT2, SETTING_CUSTOMSEARCHINT3, SETTING_CUSTOMSEARCHINT4, SETTING_CUSTOMSEARCHINT5,
+			SETTING_CUSTOMSEARCHINT6, SETTING_CUSTOMSEARCHINT7, SETTING_CUSTOMSEARCHINT8, SETTING_CUSTOMSEARCHINT9, SETTING_CUSTOMSEARCHINT10
+		};
+
+		TArray<FString> GameKeys;
+		GConfig->GetArray(TEXT("OnlineSubsystemSteamCore"), TEXT("LanAdvertisementKeys"), GameKeys, GEngineIni);
+		for (const FString& Key : GameKeys)
+		{
+			Keys.AddUnique(FName(*Key));
+		}
+
+		return Keys;
+	}();
+
+	return Dictionary;
+}
+
+static bool IsLanSettingTypeSupported(EOnlineKeyValuePairDataType::Type Type)
+{
+	switch (Type)
+	{
+	case EOnlineKeyValuePairDataType::Empty:
+	case EOnlineKeyValuePairDataType::Int32:
+	case EOnlineKeyValuePairDataType::UInt32:
+	case EOnlineKeyValuePairDataType::Int64:
+	case EOnlineKeyValuePairDataType::UInt64:
+	case EOnlineKeyValuePairDataType::Float:
+	case EOnlineKeyValuePairDataType::Double:
+	case EOnlineKeyValuePairDataType::String:
+	case EOnlineKeyValuePairDataType::Bool:
+	case EOnlineKeyValuePairDataType::Blob:
+		return true;
+	default:
+		return false;
+	}
+}
+
 void FOnlineSessionSteamCore::AppendSessionToPacket(FNboSerializeToBufferSteamCore& Packet, FOnlineSession* Session) const
 {
 	LogSteamCoreVerbose("");
-	((FNboSerializeToBuffer&)Packet) << StaticCastSharedPtr<const FUniqueNetIdSteam>(Session->OwningUserId)->m_UniqueNetId
-		<< Session->OwningUserName
-		<< Session->NumOpenPrivateConnections
-		<< Session->NumOpenPublicConnections;
+	((FNboSerializeToBuffer&)Packet) << static_cast<uint8>(LAN_ADVERTISEMENT_VERSION)
+		<< StaticCastSharedPtr<const FUniqueNetIdSteam>(Session->OwningUserId)->m_UniqueNetId;
+	SteamCore::WriteCompactString(Packet, Session->OwningUserName);
+	SteamCore::WriteVarInt(Packet, Session->NumOpenPrivateConnections);
+	SteamCore::WriteVarInt(Packet, Session->NumOpenPublicConnections);
 
 	Packet << *StaticCastSharedPtr<FOnlineSessionInfoSteamCore>(Session->SessionInfo);
 	AppendSessionSettingsToPacket(Packet, &Session->SessionSettings);
@@ -1372,43 +1567,181 @@ void FOnlineSessionSteamCore::AppendSessionSettingsToPacket(FNboSerializeToBuffe
 	LogSteamCoreVerbose("Sending session settings to client");
 #endif
 
-	((FNboSerializeToBuffer&)Packet) << SessionSettings->NumPublicConnections
-		<< SessionSettings->NumPrivateConnections
-		<< static_cast<uint8>(SessionSettings->bShouldAdvertise)
-		<< static_cast<uint8>(SessionSettings->bIsLANMatch)
-		<< static_cast<uint8>(SessionSettings->bIsDedicated)
-		<< static_cast<uint8>(SessionSettings->bUsesStats)
-		<< static_cast<uint8>(SessionSettings->bAllowJoinInProgress)
-		<< static_cast<uint8>(SessionSettings->bAllowInvites)
-		<< static_cast<uint8>(SessionSettings->bUsesPresence)
-		<< static_cast<uint8>(SessionSettings->bAllowJoinViaPresence)
-		<< static_cast<uint8>(SessionSettings->bAllowJoinViaPresenceFriendsOnly)
-		<< static_cast<uint8>(SessionSettings->bAntiCheatProtected)
-		<< SessionSettings->BuildUniqueId;
+	uint16 Flags = 0;
+	Flags |= SessionSettings->bShouldAdvertise ? LanFlag_ShouldAdvertise : 0;
+	Flags |= SessionSettings->bIsLANMatch ? LanFlag_IsLANMatch : 0;
+	Flags |= SessionSettings->bIsDedicated ? LanFlag_IsDedicated : 0;
+	Flags |= SessionSettings->bUsesStats ? LanFlag_UsesStats : 0;
+	Flags |= SessionSettings->bAllowJoinInProgress ? LanFlag_AllowJoinInProgress : 0;
+	Flags |= SessionSettings->bAllowInvites ? LanFlag_AllowInvites : 0;
+	Flags |= SessionSettings->bUsesPresence ? LanFlag_UsesPresence : 0;
+	Flags |= SessionSettings->bAllowJoinViaPresence ? LanFlag_AllowJoinViaPresence : 0;
+	Flags |= SessionSettings->bAllowJoinViaPresenceFriendsOnly ? LanFlag_AllowJoinViaPresenceFriendsOnly : 0;
+	Flags |= SessionSettings->bAntiCheatProtected ? LanFlag_AntiCheatProtected : 0;
+
+	SteamCore::WriteVarInt(Packet, SessionSettings->NumPublicConnections);
+	SteamCore::WriteVarInt(Packet, SessionSettings->NumPrivateConnections);
+	SteamCore::WriteVarUInt(Packet, Flags);
+	((FNboSerializeToBuffer&)Packet) << SessionSettings->BuildUniqueId;
+
+	TArray<const FSessionSettings::ElementType*, TInlineAllocator<32>> AdvertisedSettings;
+	for (const FSessionSettings::ElementType& Pair : SessionSettings->Settings)
+	{
+		if (Pair.Value.AdvertisementType >= EOnlineDataAdvertisementType::ViaOnlineService)
+		{
+			if (IsLanSettingTypeSupported(Pair.Value.Data.GetType()))
+			{
+				AdvertisedSettings.Add(&Pair);
+			}
+			else
+			{
+				LogSteamCoreWarn("Setting %s of type %s can't be advertised on LAN, skipping", *Pair.Key.ToString(), Pair.Value.Data.GetTypeString());
+			}
+		}
+	}
+
+	const TArray<FName>& Dictionary = GetLanKeyDictionary();
 
-	int32 NumAdvertisedProperties = 0;
-	for (FSessionSettings::TConstIterator It(SessionSettings->Settings); It; ++It)
+	SteamCore::WriteVarUInt(Packet, AdvertisedSettings.Num());
+	for (const FSessionSettings::ElementType* Pair : AdvertisedSettings)
 	{
-		const FOnlineSessionSetting& Setting = It.Value();
-		if (Setting.AdvertisementType >= EOnlineDataAdvertisementType::ViaOnlineService)
+		const FVariantData& Data = Pair->Value.Data;
+		const int32 DictionaryIndex = Dictionary.IndexOfByKey(Pair->Key);
+
+		bool bBoolValue = false;
+		if (Data.GetType() == EOnlineKeyValuePairDataType::Bool)
 		{
-			NumAdvertisedProperties++;
+			Data.GetValue(bBoolValue);
 		}
-	}
 
-	((FNboSerializeToBuffer&)Packet) << (int32)NumAdvertisedProperties;
-	for (FSessionSettings::TConstIterator It(SessionSettings->Settings); It; ++It)
-	{
-		const FOnlineSessionSetting& Setting = It.Value();
-		if (Setting.AdvertisementType >= EOnlineDataAdvertisementType::ViaOnlineService)
+		uint8 Header = static_cast<uint8>(Data.GetType()) & LanSetting_TypeMask;
+		Header |= (static_cast<uint8>(Pair->Value.AdvertisementType) << LanSetting_AdvertisementShift) & LanSetting_AdvertisementMask;
+		Header |= bBoolValue ? LanSetting_BoolValue : 0;
+		Header |= DictionaryIndex != INDEX_NONE ? LanSetting_DictionaryKey : 0;
+		((FNboSerializeToBuffer&)Packet) << Header;
+
+		if (DictionaryIndex != INDEX_NONE)
 		{
-			((FNboSerializeToBuffer&)Packet) << It.Key();
-			Packet << Setting;
+			SteamCore::WriteVarUInt(Packet, DictionaryIndex);
+		}
+		else
+		{
+			SteamCore::WriteCompactString(Packet, Pair->Key.ToString());
+		}
+
+		switch (Data.GetType())
+		{
+		case EOnlineKeyValuePairDataType::Int32:
+			{
+				int32 Value;
+				Data.GetValue(Value);
+				SteamCore::WriteVarInt(Packet, Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::UInt32:
+			{
+				uint32 Value;
+				Data.GetValue(Value);
+				SteamCore::WriteVarUInt(Packet, Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::Int64:
+			{
+				int64 Value;
+				Data.GetValue(Value);
+				SteamCore::WriteVarInt(Packet, Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::UInt64:
+			{
+				uint64 Value;
+				Data.GetValue(Value);
+				SteamCore::WriteVarUInt(Packet, Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::Float:
+			{
+				float Value;
+				Data.GetValue(Value);
+				((FNboSerializeToBuffer&)Packet) << Value;
+				break;
+			}
+		case EOnlineKeyValuePairDataType::Double:
+			{
+				double Value;
+				Data.GetValue(Value);
+				((FNboSerializeToBuffer&)Packet) << Value;
+				break;
+			}
+		case EOnlineKeyValuePairDataType::String:
+			{
+				FString Value;
+				Data.GetValue(Value);
+				SteamCore::WriteCompactString(Packet, Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::Blob:
+			{
+				TArray<uint8> Value;
+				Data.GetValue(Value);
+				SteamCore::WriteVarUInt(Packet, Value.Num());
+				Packet.WriteBinary(Value.GetData(), Value.Num());
+				break;
+			}
+		default:
+			break;
+		}
+
 #if DEBUG_LAN_BEACON
-			LogSteamCoreVerbose("%s", *Setting.ToString());
+		LogSteamCoreVerbose("%s", *Pair->Value.ToString());
 #endif
+	}
+}
+
+TArray<uint8> FOnlineSessionSteamCore::GetLanAdvertisement(FNamedOnlineSession& Session)
+{
+	FScopeLock ScopeLock(&m_SessionLock);
+
+	// Settings can be changed in place through GetNamedSession, so besides explicit invalidation the cached packet is rebuilt when the
+	// open slots or number of settings change, and at least once per LAN_ADVERTISEMENT_MAX_AGE.
+	// Known limitation: a setting whose value is edited in place without going through UpdateSession is advertised with its old
+	// value for up to LAN_ADVERTISEMENT_MAX_AGE, UpdateSession and GetSessionSettings invalidate the packet right away.
+	const double Now = FPlatformTime::Seconds();
+	FLanAdvertisement& Advertisement = m_LanAdvertisements.FindOrAdd(Session.SessionName);
+	if (Advertisement.m_Payload.Num() == 0 ||
+		Advertisement.m_NumOpenPublicConnections != Session.NumOpenPublicConnections ||
+		Advertisement.m_NumOpenPrivateConnections != Session.NumOpenPrivateConnections ||
+		Advertisement.m_NumSettings != Session.SessionSettings.Settings.Num() ||
+		Now - Advertisement.m_BuildTime >= LAN_ADVERTISEMENT_MAX_AGE)
+	{
+		// The payload goes out behind the beacon header, so it only gets what is left of the packet after it
+		FNboSerializeToBufferSteamCore Header(LAN_BEACON_MAX_PACKET_SIZE);
+		m_LANSession->CreateHostResponsePacket(Header, 0);
+
+		FNboSerializeToBufferSteamCore Packet(LAN_BEACON_MAX_PACKET_SIZE - Header.GetByteCount());
+		AppendSessionToPacket(Packet, &Session);
+
+		if (Packet.HasOverflow())
+		{
+			LogSteamCoreWarn("LAN advertisement for session %s doesn't fit in a beacon packet, it is not advertised", *Session.SessionName.ToString());
+			m_LanAdvertisements.Remove(Session.SessionName);
+			return TArray<uint8>();
 		}
+
+		Advertisement.m_Payload = TArray<uint8>(Packet.GetRawBuffer(0), Packet.GetByteCount());
+		Advertisement.m_NumOpenPublicConnections = Session.NumOpenPublicConnections;
+		Advertisement.m_NumOpenPrivateConnections = Session.NumOpenPrivateConnections;
+		Advertisement.m_NumSettings = Session.SessionSettings.Settings.Num();
+		Advertisement.m_BuildTime = Now;
 	}
+
+	return Advertisement.m_Payload;
+}
+
+void FOnlineSessionSteamCore::InvalidateLanAdvertisement(FName SessionName)
+{
+	FScopeLock ScopeLock(&m_SessionLock);
+	m_LanAdvertisements.Remove(SessionName);
 }
 
 void FOnlineSessionSteamCore::OnValidQueryPacketReceived(uint8* PacketData, int32 PacketLength, uint64 ClientNonce)
@@ -1429,28 +1762,45 @@ void FOnlineSessionSteamCore::OnValidQueryPacketReceived(uint8* PacketData, int3
 
 		if (bIsMatchJoinable)
 		{
+			const TArray<uint8> Advertisement = GetLanAdvertisement(Session);
+			if (Advertisement.Num() == 0)
+			{
+				continue;
+			}
+
 			FNboSerializeToBufferSteamCore Packet(LAN_BEACON_MAX_PACKET_SIZE);
 			m_LANSession->CreateHostResponsePacket(Packet, ClientNonce);
-
-			AppendSessionToPacket(Packet, &Session);
+			Packet.WriteBinary(Advertisement.GetData(), Advertisement.Num());
 
 			m_LANSession->BroadcastPacket(Packet, Packet.GetByteCount());
 		}
 	}
 }
 
-void FOnlineSessionSteamCore::ReadSessionFromPacket(FNboSerializeFromBufferSteamCore& Packet, FOnlineSession* Session) const
+bool FOnlineSessionSteamCore::ReadSessionFromPacket(FNboSerializeFromBufferSteamCore& Packet, FOnlineSession* Session) const
 {
 	LogSteamCoreVerbose("");
 #if DEBUG_LAN_BEACON
 	LogSteamCoreVerbose("Reading session information from server");
 #endif
 
+	uint8 Version = 0;
+	Packet >> Version;
+	if (Packet.HasOverflow() || Version != LAN_ADVERTISEMENT_VERSION)
+	{
+		LogSteamCoreVerbose("Ignoring LAN advertisement with version %d, expected %d", Version, LAN_ADVERTISEMENT_VERSION);
+		return false;
+	}
+
 	uint64 OwningUserId;
-	Packet >> OwningUserId
-		>> Session->OwningUserName
-		>> Session->NumOpenPrivateConnections
-		>> Session->NumOpenPublicConnections;
+	Packet >> OwningUserId;
+	if (!SteamCore::ReadCompactString(Packet, Session->OwningUserName))
+	{
+		return false;
+	}
+
+	Session->NumOpenPrivateConnections = static_cast<int32>(SteamCore::ReadVarInt(Packet));
+	Session->NumOpenPublicConnections = static_cast<int32>(SteamCore::ReadVarInt(Packet));
 
 	Session->OwningUserId = FUniqueNetIdSteam::Create(OwningUserId);
 
@@ -1459,10 +1809,10 @@ void FOnlineSessionSteamCore::ReadSessionFromPacket(FNboSerializeFromBufferSteam
 	Packet >> *SteamSessionInfo;
 	Session->SessionInfo = MakeShareable(SteamSessionInfo);
 
-	ReadSettingsFromPacket(Packet, Session->SessionSettings);
+	return ReadSettingsFromPacket(Packet, Session->SessionSettings);
 }
 
-void FOnlineSessionSteamCore::ReadSettingsFromPacket(FNboSerializeFromBufferSteamCore& Packet, FOnlineSessionSettings& SessionSettings)
+bool FOnlineSessionSteamCore::ReadSettingsFromPacket(FNboSerializeFromBufferSteamCore& Packet, FOnlineSessionSettings& SessionSettings)
 {
 	LogSteamCoreVerbose("");
 #if DEBUG_LAN_BEACON
@@ -1471,57 +1821,133 @@ void FOnlineSessionSteamCore::ReadSettingsFromPacket(FNboSerializeFromBufferStea
 
 	SessionSettings.Settings.Empty();
 
-	Packet >> SessionSettings.NumPublicConnections
-		>> SessionSettings.NumPrivateConnections;
-	uint8 Read = 0;
-	Packet >> Read;
-	SessionSettings.bShouldAdvertise = !!Read;
-	Packet >> Read;
-	SessionSettings.bIsLANMatch = !!Read;
-	Packet >> Read;
-	SessionSettings.bIsDedicated = !!Read;
-	Packet >> Read;
-	SessionSettings.bUsesStats = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowJoinInProgress = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowInvites = !!Read;
-	Packet >> Read;
-	SessionSettings.bUsesPresence = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowJoinViaPresence = !!Read;
-	Packet >> Read;
-	SessionSettings.bAllowJoinViaPresenceFriendsOnly = !!Read;
-	Packet >> Read;
-	SessionSettings.bAntiCheatProtected = !!Read;
+	SessionSettings.NumPublicConnections = static_cast<int32>(SteamCore::ReadVarInt(Packet));
+	SessionSettings.NumPrivateConnections = static_cast<int32>(SteamCore::ReadVarInt(Packet));
+
+	const uint64 Flags = SteamCore::ReadVarUInt(Packet);
+	SessionSettings.bShouldAdvertise = !!(Flags & LanFlag_ShouldAdvertise);
+	SessionSettings.bIsLANMatch = !!(Flags & LanFlag_IsLANMatch);
+	SessionSettings.bIsDedicated = !!(Flags & LanFlag_IsDedicated);
+	SessionSettings.bUsesStats = !!(Flags & LanFlag_UsesStats);
+	SessionSettings.bAllowJoinInProgress = !!(Flags & LanFlag_AllowJoinInProgress);
+	SessionSettings.bAllowInvites = !!(Flags & LanFlag_AllowInvites);
+	SessionSettings.bUsesPresence = !!(Flags & LanFlag_UsesPresence);
+	SessionSettings.bAllowJoinViaPresence = !!(Flags & LanFlag_AllowJoinViaPresence);
+	SessionSettings.bAllowJoinViaPresenceFriendsOnly = !!(Flags & LanFlag_AllowJoinViaPresenceFriendsOnly);
+	SessionSettings.bAntiCheatProtected = !!(Flags & LanFlag_AntiCheatProtected);
 
 	Packet >> SessionSettings.BuildUniqueId;
 
-	int32 NumAdvertisedProperties = 0;
-	Packet >> NumAdvertisedProperties;
-	if (Packet.HasOverflow() == false)
+	const TArray<FName>& Dictionary = GetLanKeyDictionary();
+
+	const uint64 NumAdvertisedProperties = SteamCore::ReadVarUInt(Packet);
+	bool bValid = !Packet.HasOverflow();
+	for (uint64 Index = 0; Index < NumAdvertisedProperties && bValid && !Packet.HasOverflow(); Index++)
 	{
+		uint8 Header = 0;
+		Packet >> Header;
+
 		FName Key;
-		for (int32 Index = 0;
-		     Index < NumAdvertisedProperties && Packet.HasOverflow() == false;
-		     Index++)
+		if (Header & LanSetting_DictionaryKey)
+		{
+			const uint64 DictionaryIndex = SteamCore::ReadVarUInt(Packet);
+			if (DictionaryIndex >= static_cast<uint64>(Dictionary.Num()))
+			{
+				LogSteamCoreWarn("LAN advertisement uses unknown key index %llu, LanAdvertisementKeys differs between host and client", DictionaryIndex);
+				bValid = false;
+				break;
+			}
+			Key = Dictionary[static_cast<int32>(DictionaryIndex)];
+		}
+		else
+		{
+			FString KeyStr;
+			bValid = SteamCore::ReadCompactString(Packet, KeyStr);
+			Key = FName(*KeyStr);
+		}
+
+		FOnlineSessionSetting Setting;
+		Setting.AdvertisementType = static_cast<EOnlineDataAdvertisementType::Type>((Header & LanSetting_AdvertisementMask) >> LanSetting_AdvertisementShift);
+
+		switch (static_cast<EOnlineKeyValuePairDataType::Type>(Header & LanSetting_TypeMask))
+		{
+		case EOnlineKeyValuePairDataType::Empty:
+			break;
+		case EOnlineKeyValuePairDataType::Int32:
+			Setting.Data.SetValue(static_cast<int32>(SteamCore::ReadVarInt(Packet)));
+			break;
+		case EOnlineKeyValuePairDataType::UInt32:
+			Setting.Data.SetValue(static_cast<uint32>(SteamCore::ReadVarUInt(Packet)));
+			break;
+		case EOnlineKeyValuePairDataType::Int64:
+			Setting.Data.SetValue(static_cast<int64>(SteamCore::ReadVarInt(Packet)));
+			break;
+		case EOnlineKeyValuePairDataType::UInt64:
+			Setting.Data.SetValue(static_cast<uint64>(SteamCore::ReadVarUInt(Packet)));
+			break;
+		case EOnlineKeyValuePairDataType::Float:
+			{
+				float Value = 0.0f;
+				Packet >> Value;
+				Setting.Data.SetValue(Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::Double:
+			{
+				double Value = 0.0;
+				Packet >> Value;
+				Setting.Data.SetValue(Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::String:
+			{
+				FString Value;
+				bValid = bValid && SteamCore::ReadCompactString(Packet, Value);
+				Setting.Data.SetValue(Value);
+				break;
+			}
+		case EOnlineKeyValuePairDataType::Bool:
+			Setting.Data.SetValue(!!(Header & LanSetting_BoolValue));
+			break;
+		case EOnlineKeyValuePairDataType::Blob:
+			{
+				const uint64 Length = SteamCore::ReadVarUInt(Packet);
+				if (Length > LAN_BEACON_MAX_PACKET_SIZE)
+				{
+					bValid = false;
+					break;
+				}
+
+				TArray<uint8> Value;
+				Value.SetNumUninitialized(static_cast<int32>(Length));
+				Packet.ReadBinary(Value.GetData(), static_cast<uint32>(Length));
+				Setting.Data.SetValue(Value);
+				break;
+			}
+		default:
+			LogSteamCoreWarn("LAN advertisement contains a setting of unsupported type %d", Header & LanSetting_TypeMask);
+			bValid = false;
+			break;
+		}
+
+		if (bValid && !Packet.HasOverflow())
 		{
-			FOnlineSessionSetting Setting;
-			Packet >> Key;
-			Packet >> Setting;
 			SessionSettings.Set(Key, Setting);
 
 #if DEBUG_LAN_BEACON
-			LogSteamCoreVerbose("%s", *Setting->ToString());
+			LogSteamCoreVerbose("%s", *Setting.ToString());
 #endif
 		}
 	}
 
-	if (Packet.HasOverflow())
+	if (!bValid || Packet.HasOverflow())
 	{
 		SessionSettings.Settings.Empty();
-		LogSteamCoreVerbose("Packet overflow detected in ReadGameSettingsFromPacket()");
+		LogSteamCoreVerbose("Malformed or truncated settings in ReadSettingsFromPacket()");
+		return false;
 	}
+
+	return true;
 }
 
 void FOnlineSessionSteamCore::OnValidResponsePacketReceived(uint8* PacketData, int32 PacketLength)
@@ -1535,7 +1961,10 @@ void FOnlineSessionSteamCore::OnValidResponsePacketReceived(uint8* PacketData, i
 
 		FNboSerializeFromBufferSteamCore Packet(PacketData, PacketLength);
 
-		ReadSessionFromPacket(Packet, NewSession);
+		if (!ReadSessionFromPacket(Packet, NewSession))
+		{
+			m_CurrentSessionSearch->SearchResults.RemoveAt(m_CurrentSessionSearch->SearchResults.Num() - 1);
+		}
 	}
 	else
 	{
@@ -132,7 +132,7 @@ public:
 		const FOnlineSessionSteamCorePtr SessionInt = StaticCastSharedPtr<FOnlineSessionSteamCore>(Subsystem->GetSessionInterface());
 		if (SessionInt.IsValid() && SessionInt->m_CurrentSessionSearch.IsValid() && SessionInt->m_CurrentSessionSearch->SearchState == EOnlineAsyncTaskState::InProgress)
 		{
-			SessionInt->m_PendingSearchLobbyIds.AddUnique(m_LobbyId);
+			SessionInt->OnSearchLobbyDataReceived(m_LobbyId);
 		}
 		else
 		{
@@ -7,8 +7,211 @@
 #include "OnlineAsyncTaskManagerAsyncTasksSteamCore.h"
 #include "OnlineSubsystemSteamCorePrivatePCH.h" 
 #include "ExternalUI/OnlineExternalUITypesSteamCore.h"
+#include "Algo/BinarySearch.h"
+
+namespace SteamCore
+{
+	const TCHAR* LexToString(const ESteamCoreAsyncTaskCategory Category)
+	{
+		switch (Category)
+		{
+		default:
+		case ESteamCoreAsyncTaskCategory::General:
+			return TEXT("General");
+		case ESteamCoreAsyncTaskCategory::Session:
+			return TEXT("Session");
+		case ESteamCoreAsyncTaskCategory::Lobby:
+			return TEXT("Lobby");
+		case ESteamCoreAsyncTaskCategory::ServerBrowser:
+			return TEXT("ServerBrowser");
+		case ESteamCoreAsyncTaskCategory::Leaderboard:
+			return TEXT("Leaderboard");
+		case ESteamCoreAsyncTaskCategory::Stats:
+			return TEXT("Stats");
+		case ESteamCoreAsyncTaskCategory::UGC:
+			return TEXT("UGC");
+		case ESteamCoreAsyncTaskCategory::Storage:
+			return TEXT("Storage");
+		case ESteamCoreAsyncTaskCategory::Inventory:
+			return TEXT("Inventory");
+		case ESteamCoreAsyncTaskCategory::Friends:
+			return TEXT("Friends");
+		}
+	}
+}
 
 #if WITH_STEAMCORE
+FOnlineAsyncTaskManagerSteamCore::~FOnlineAsyncTaskManagerSteamCore()
+{
+	// The online thread is gone by now, tasks that never finished are dropped the way the stock queues drop theirs
+	for (const FScheduledTask& Scheduled : m_WaitingTasks)
+	{
+		delete Scheduled.Task;
+	}
+	for (const FScheduledTask& Scheduled : m_RunningTasks)
+	{
+		delete Scheduled.Task;
+	}
+}
+
+void FOnlineAsyncTaskManagerSteamCore::InitScheduler()
+{
+	m_MaxRunningTasks = 16;
+	m_NextScheduledHandle = 1;
+
+	for (int32 Index = 0; Index < static_cast<int32>(ESteamCoreAsyncTaskCategory::Count); Index++)
+	{
+		m_NumRunningTasks[Index] = 0;
+		m_CategoryLimits[Index] = 4;
+	}
+	m_CategoryLimits[static_cast<int32>(ESteamCoreAsyncTaskCategory::General)] = 8;
+	m_CategoryLimits[static_cast<int32>(ESteamCoreAsyncTaskCategory::Session)] = 2;
+	m_CategoryLimits[static_cast<int32>(ESteamCoreAsyncTaskCategory::Storage)] = 2;
+	m_CategoryLimits[static_cast<int32>(ESteamCoreAsyncTaskCategory::Inventory)] = 2;
+
+	GConfig->GetInt(TEXT("OnlineSubsystemSteamCore"), TEXT("MaxRunningScheduledTasks"), m_MaxRunningTasks, GEngineIni);
+	m_MaxRunningTasks = FMath::Max(m_MaxRunningTasks, 1);
+
+	for (int32 Index = 0; Index < static_cast<int32>(ESteamCoreAsyncTaskCategory::Count); Index++)
+	{
+		const ESteamCoreAsyncTaskCategory Category = static_cast<ESteamCoreAsyncTaskCategory>(Index);
+		GConfig->GetInt(TEXT("OnlineSubsystemSteamCore"), *FString::Printf(TEXT("MaxRunning%sTasks"), SteamCore::LexToString(Category)), m_CategoryLimits[Index], GEngineIni);
+		m_CategoryLimits[Index] = FMath::Max(m_CategoryLimits[Index], 1);
+	}
+
+	// The server browser tasks share one request slot on the subsystem, running two at once would overwrite it
+	m_CategoryLimits[static_cast<int32>(ESteamCoreAsyncTaskCategory::ServerBrowser)] = 1;
+}
+
+uint32 FOnlineAsyncTaskManagerSteamCore::AddToScheduler(FOnlineAsyncTask* Task, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority, TFunction<void()> OnCancelled)
+{
+	check(Task);
+
+	FScheduledTask Scheduled;
+	Scheduled.Task = Task;
+	Scheduled.Category = Category;
+	Scheduled.Priority = Priority;
+	Scheduled.OnCancelled = MoveTemp(OnCancelled);
+
+	FScopeLock Lock(&m_SchedulerLock);
+	Scheduled.Handle = m_NextScheduledHandle++;
+
+	// Keep the list ordered so the online thread can start tasks in one pass
+	const int32 InsertIndex = Algo::UpperBoundBy(m_WaitingTasks, static_cast<uint8>(Priority), [](const FScheduledTask& Waiting)
+	{
+		return static_cast<uint8>(Waiting.Priority);
+	}, TGreater<>());
+	m_WaitingTasks.Insert(Scheduled, InsertIndex);
+
+	LogSteamCoreVerbose("Scheduled %s as %u in %s", *Task->ToString(), Scheduled.Handle, SteamCore::LexToString(Category));
+	return Scheduled.Handle;
+}
+
+bool FOnlineAsyncTaskManagerSteamCore::CancelScheduledTask(uint32 Handle)
+{
+	FScheduledTask Cancelled;
+	{
+		FScopeLock Lock(&m_SchedulerLock);
+		const int32 Index = m_WaitingTasks.IndexOfByPredicate([Handle](const FScheduledTask& Waiting)
+		{
+			return Waiting.Handle == Handle;
+		});
+
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+
+		Cancelled = MoveTemp(m_WaitingTasks[Index]);
+		m_WaitingTasks.RemoveAt(Index);
+	}
+
+	FinishCancelledTask(Cancelled);
+	return true;
+}
+
+int32 FOnlineAsyncTaskManagerSteamCore::CancelScheduledTasks(ESteamCoreAsyncTaskCategory Category)
+{
+	TArray<FScheduledTask> Cancelled;
+	{
+		FScopeLock Lock(&m_SchedulerLock);
+		for (int32 Index = m_WaitingTasks.Num() - 1; Index >= 0; Index--)
+		{
+			if (m_WaitingTasks[Index].Category == Category)
+			{
+				Cancelled.Add(MoveTemp(m_WaitingTasks[Index]));
+				m_WaitingTasks.RemoveAt(Index);
+			}
+		}
+	}
+
+	// Collected back to front, hand them out in queue order
+	for (int32 Index = Cancelled.Num() - 1; Index >= 0; Index--)
+	{
+		FinishCancelledTask(Cancelled[Index]);
+	}
+	return Cancelled.Num();
+}
+
+void FOnlineAsyncTaskManagerSteamCore::FinishCancelledTask(FScheduledTask& Scheduled)
+{
+	// Never ticked, so without the hook its result members are whatever the constructor left in them
+	if (Scheduled.OnCancelled)
+	{
+		Scheduled.OnCancelled();
+	}
+
+	LogSteamCoreVerbose("Cancelled %s, success: %d", *Scheduled.Task->ToString(), Scheduled.Task->WasSuccessful());
+	AddToOutQueue(Scheduled.Task);
+}
+
+int32 FOnlineAsyncTaskManagerSteamCore::GetNumScheduledTasks() const
+{
+	FScopeLock Lock(&m_SchedulerLock);
+	return m_WaitingTasks.Num() + m_RunningTasks.Num();
+}
+
+void FOnlineAsyncTaskManagerSteamCore::TickScheduledTasks()
+{
+	{
+		FScopeLock Lock(&m_SchedulerLock);
+		for (int32 Index = 0; Index < m_WaitingTasks.Num() && m_RunningTasks.Num() < m_MaxRunningTasks; )
+		{
+			const int32 CategoryIndex = static_cast<int32>(m_WaitingTasks[Index].Category);
+			if (m_NumRunningTasks[CategoryIndex] >= m_CategoryLimits[CategoryIndex])
+			{
+				Index++;
+				continue;
+			}
+
+			m_NumRunningTasks[CategoryIndex]++;
+			m_RunningTasks.Add(m_WaitingTasks[Index]);
+			m_WaitingTasks.RemoveAt(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	// Ticked without the lock so tasks can schedule or cancel other tasks
+	for (int32 Index = 0; Index < m_RunningTasks.Num(); )
+	{
+		FOnlineAsyncTask* Task = m_RunningTasks[Index].Task;
+		Task->Tick();
+
+		if (!Task->IsDone())
+		{
+			Index++;
+			continue;
+		}
+
+		LogSteamCoreVerbose("%s finished in %.3f seconds, success: %d", *Task->ToString(), Task->GetElapsedTime(), Task->WasSuccessful());
+		{
+			FScopeLock Lock(&m_SchedulerLock);
+			m_NumRunningTasks[static_cast<int32>(m_RunningTasks[Index].Category)]--;
+			m_RunningTasks.RemoveAt(Index, 1, EAllowShrinking::No);
+		}
+		AddToOutQueue(Task);
+	}
+}
+
 void FOnlineAsyncTaskManagerSteamCore::OnlineTick()
 {
 	check(m_SteamSubsystem);
@@ -23,6 +226,8 @@ void FOnlineAsyncTaskManagerSteamCore::OnlineTick()
 	{
 		SteamGameServer_RunCallbacks();
 	}
+
+	TickScheduledTasks();
 }
 
 void FOnlineAsyncTaskManagerSteamCore::OnInviteAccepted(GameRichPresenceJoinRequested_t* pParam)
@@ -9,6 +9,7 @@
 #include "OnlineSubsystemSteamCorePrivate.h"
 #include "OnlineAsyncTaskManager.h"
 #include "OnlineSubsystemSteamCorePackage.h"
+#include "OnlineSubsystemSteamCoreTypes.h"
 
 #if WITH_STEAMCORE
 class ONLINESUBSYSTEMSTEAMCORE_API FOnlineAsyncTaskSteamCore : public FOnlineAsyncTaskBasic<class FOnlineSubsystemSteamCore>
@@ -66,16 +67,64 @@ public:
 		  m_OnRichPresenceUpdateCallback(this, &FOnlineAsyncTaskManagerSteamCore::OnRichPresenceUpdate),
 		  m_OnFriendStatusUpdateCallback(this, &FOnlineAsyncTaskManagerSteamCore::OnFriendStatusUpdate)
 	{
+		InitScheduler();
 	}
 
-	virtual ~FOnlineAsyncTaskManagerSteamCore() override
-	{
-	}
+	virtual ~FOnlineAsyncTaskManagerSteamCore() override;
 
 	virtual void OnlineTick() override;
 
+	/**
+	* Runs Task alongside other scheduled tasks instead of behind the serial in queue.
+	* Waiting tasks start by priority as soon as their category and the scheduler have a free slot.
+	* OnCancelled runs if the task is cancelled before it starts, it has to leave the task complete with a failure result.
+	* Returns a handle for CancelScheduledTask. Can be called from any thread.
+	*/
+	uint32 AddToScheduler(FOnlineAsyncTask* Task, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority = ESteamCoreAsyncTaskPriority::Normal, TFunction<void()> OnCancelled = nullptr);
+
+	/**
+	* Fails a scheduled task that has not started yet, its OnCancelled runs and it is finalized without doing any work.
+	* Returns false if the task already started or finished.
+	*/
+	bool CancelScheduledTask(uint32 Handle);
+
+	/** Cancels every waiting task of Category, returns the number cancelled */
+	int32 CancelScheduledTasks(ESteamCoreAsyncTaskCategory Category);
+
+	/** Number of scheduled tasks waiting to start and running */
+	int32 GetNumScheduledTasks() const;
+
 protected:
 	FOnlineSubsystemSteamCore* m_SteamSubsystem;
+
+	struct FScheduledTask
+	{
+		FOnlineAsyncTask* Task = nullptr;
+		uint32 Handle = 0;
+		ESteamCoreAsyncTaskCategory Category = ESteamCoreAsyncTaskCategory::General;
+		ESteamCoreAsyncTaskPriority Priority = ESteamCoreAsyncTaskPriority::Normal;
+		TFunction<void()> OnCancelled;
+	};
+
+	void InitScheduler();
+	void TickScheduledTasks();
+
+	/** Settles a waiting task on its failure result and hands it to the game thread */
+	void FinishCancelledTask(FScheduledTask& Scheduled);
+
+	/** Guards the waiting tasks, which are added from the game thread */
+	mutable FCriticalSection m_SchedulerLock;
+
+	/** Waiting tasks, highest priority first then in queue order */
+	TArray<FScheduledTask> m_WaitingTasks;
+
+	/** Started tasks, only touched on the online thread */
+	TArray<FScheduledTask> m_RunningTasks;
+	int32 m_NumRunningTasks[static_cast<int32>(ESteamCoreAsyncTaskCategory::Count)];
+
+	int32 m_CategoryLimits[static_cast<int32>(ESteamCoreAsyncTaskCategory::Count)];
+	int32 m_MaxRunningTasks;
+	uint32 m_NextScheduledHandle;
 	
 	STEAM_CALLBACK(FOnlineAsyncTaskManagerSteamCore, OnP2PSessionRequest, P2PSessionRequest_t, m_OnP2PSessionRequestCallback);
 	STEAM_CALLBACK(FOnlineAsyncTaskManagerSteamCore, OnP2PSessionConnectFail, P2PSessionConnectFail_t, m_OnP2PSessionConnectFailCallback);
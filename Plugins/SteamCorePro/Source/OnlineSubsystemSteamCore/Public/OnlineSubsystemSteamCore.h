@@ -34,6 +34,8 @@ class FSteamCoreServerInstanceHandler;
 class FSteamCoreClientInstanceHandler;
 class FOnlineAsyncTaskManagerSteamCore;
 struct FSteamUserCloudData;
+enum class ESteamCoreAsyncTaskCategory : uint8;
+enum class ESteamCoreAsyncTaskPriority : uint8;
 
 typedef TSharedPtr<FOnlineSessionSteamCore, ESPMode::ThreadSafe> FOnlineSessionSteamCorePtr;
 typedef TSharedPtr<FOnlineIdentitySteamCore, ESPMode::ThreadSafe> FOnlineIdentitySteamCorePtr;
@@ -90,6 +92,15 @@ PACKAGE_SCOPE:
 	bool InitSteamworksServer();
 	void ShutdownSteamworks();
 	void QueueAsyncTask(class FOnlineAsyncTask* AsyncTask);
+
+	/**
+	* Runs AsyncTask concurrently with other scheduled tasks instead of behind the serial queue, returns a handle for CancelAsyncTask.
+	* OnCancelled is called if the task is cancelled before it starts and must mark it complete and failed.
+	*/
+	uint32 ScheduleAsyncTask(class FOnlineAsyncTask* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority, TFunction<void()> OnCancelled = nullptr);
+
+	/** Cancels a scheduled task that has not started yet, it finishes unsuccessfully */
+	bool CancelAsyncTask(uint32 Handle);
 	void QueueAsyncOutgoingItem(class FOnlineAsyncItem* AsyncItem);
 	FSteamUserCloudData* GetUserCloudEntry(const FUniqueNetId& UserId);
 
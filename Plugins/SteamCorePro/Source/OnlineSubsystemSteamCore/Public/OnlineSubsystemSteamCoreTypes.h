@@ -228,6 +228,11 @@ namespace SteamCore
 	FSteamConnectionMethod ToConnectionMethod(const FString& InString);
 }
 
+namespace SteamCore
+{
+	ONLINESUBSYSTEMSTEAMCORE_API const TCHAR* LexToString(const ESteamCoreAsyncTaskCategory Category);
+}
+
 #if WITH_STEAMCORE
 class ONLINESUBSYSTEMSTEAMCORE_API FOnlineSessionInfoSteamCore : public FOnlineSessionInfo
 {
@@ -14,6 +14,13 @@
 #include "OnlineSubsystemSteamCore.h"
 #include "OnlineSubsystemSteamCorePackage.h"
 
+/** Set to true in a lobby search's QuerySettings to receive every lobby through OnLobbySearchResultReceived as it is parsed */
+#define SEARCH_STEAM_STREAM_RESULTS TEXT("SteamStreamResults")
+/** int32, a streaming search completes once this many lobbies were parsed */
+#define SEARCH_STEAM_EARLY_COMPLETE_RESULTS TEXT("SteamEarlyCompleteResults")
+/** float seconds, a streaming search completes at this age if at least one lobby was parsed */
+#define SEARCH_STEAM_SOFT_TIMEOUT TEXT("SteamSoftTimeout")
+
 #if WITH_STEAMCORE
 
 class ONLINESUBSYSTEMSTEAMCORE_API FOnlineAsyncTaskSteamCoreCreateLobby : public FOnlineAsyncTaskSteamCore
@@ -55,16 +62,19 @@ class ONLINESUBSYSTEMSTEAMCORE_API FOnlineAsyncTaskSteamCoreUpdateLobby : public
 {
 	FOnlineAsyncTaskSteamCoreUpdateLobby()
 		: m_SessionName(NAME_None),
-		  m_bUpdateOnlineData(false)
+		  m_bUpdateOnlineData(false),
+		  m_NumCoalescedUpdates(1)
 	{
 	}
 
 public:
-	FOnlineAsyncTaskSteamCoreUpdateLobby(class FOnlineSubsystemSteamCore* InSubsystem, FName InSessionName, bool bInUpdateOnlineData, const FOnlineSessionSettings& InNewSessionSettings)
+	/** InNumCoalescedUpdates is the number of UpdateSession calls folded into this one, each of them gets its completion delegate */
+	FOnlineAsyncTaskSteamCoreUpdateLobby(class FOnlineSubsystemSteamCore* InSubsystem, FName InSessionName, bool bInUpdateOnlineData, const FOnlineSessionSettings& InNewSessionSettings, int32 InNumCoalescedUpdates = 1)
 		: FOnlineAsyncTaskSteamCore(InSubsystem, k_uAPICallInvalid),
 		  m_SessionName(InSessionName),
 		  m_NewSessionSettings(InNewSessionSettings),
-		  m_bUpdateOnlineData(bInUpdateOnlineData)
+		  m_bUpdateOnlineData(bInUpdateOnlineData),
+		  m_NumCoalescedUpdates(InNumCoalescedUpdates)
 	{
 	}
 
@@ -76,6 +86,7 @@ private:
 	FName m_SessionName;
 	FOnlineSessionSettings m_NewSessionSettings;
 	bool m_bUpdateOnlineData;
+	int32 m_NumCoalescedUpdates;
 };
 
 class ONLINESUBSYSTEMSTEAMCORE_API FOnlineAsyncTaskSteamCoreJoinLobby : public FOnlineAsyncTaskSteamCore
@@ -128,7 +139,7 @@ private:
 class ONLINESUBSYSTEMSTEAMCORE_API FOnlineAsyncTaskSteamCoreFindLobbiesBase : public FOnlineAsyncTaskSteamCore
 {
 	FOnlineAsyncTaskSteamCoreFindLobbiesBase()
-		: m_FindLobbiesState(EFindLobbiesState::Init), m_CallbackResults(), m_SteamMatchmakingPtr(nullptr)
+		: m_FindLobbiesState(EFindLobbiesState::Init), m_CallbackResults(), m_bStreamResults(false), m_EarlyCompleteResults(0), m_SoftTimeout(ASYNC_TASK_TIMEOUT), m_SteamMatchmakingPtr(nullptr)
 	{
 	}
 
@@ -139,10 +150,16 @@ public:
 		: FOnlineAsyncTaskSteamCore(InSubsystem, k_uAPICallInvalid),
 		  m_SearchSettings(InSearchSettings),
 		  m_FindLobbiesState(EFindLobbiesState::Init),
-		  m_CallbackResults(), m_SteamMatchmakingPtr(SteamMatchmaking())
+		  m_CallbackResults(),
+		  m_bStreamResults(false),
+		  m_EarlyCompleteResults(0),
+		  m_SoftTimeout(ASYNC_TASK_TIMEOUT),
+		  m_SteamMatchmakingPtr(SteamMatchmaking())
 	{
 	}
 
+	bool IsStreamingResults() const { return m_bStreamResults; }
+
 PACKAGE_SCOPE:
 	enum class EFindLobbiesState : uint8
 	{
@@ -158,6 +175,18 @@ PACKAGE_SCOPE:
 	LobbyMatchList_t m_CallbackResults;
 	TArray<CSteamID> m_LobbyIDs;
 
+	/**
+	* When streaming, every lobby is parsed into SearchResults as its data arrives instead of all at once in Finalize.
+	* The search ends once m_EarlyCompleteResults lobbies are parsed, or at m_SoftTimeout if at least one was,
+	* and ASYNC_TASK_TIMEOUT stays the hard limit.
+	*/
+	bool m_bStreamResults;
+	int32 m_EarlyCompleteResults;
+	float m_SoftTimeout;
+
+	/** Enables streaming if the search asked for it with SEARCH_STEAM_STREAM_RESULTS, streaming is off by default */
+	void InitStreaming();
+
 	void ParseSearchResult(const FUniqueNetIdSteam& LobbyId) const;
 	virtual void Tick() override;
 	virtual void Finalize() override;
@@ -172,6 +201,7 @@ public:
 	FOnlineAsyncTaskSteamCoreFindLobbies(class FOnlineSubsystemSteamCore* InSubsystem, const TSharedPtr<FOnlineSessionSearch>& InSearchSettings)
 		: FOnlineAsyncTaskSteamCoreFindLobbiesBase(InSubsystem, InSearchSettings)
 	{
+		InitStreaming();
 	}
 
 	virtual FString ToString() const override;
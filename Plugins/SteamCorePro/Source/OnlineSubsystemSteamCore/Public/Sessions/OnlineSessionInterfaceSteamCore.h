@@ -24,6 +24,10 @@ class FOnlineSubsystemSteamCore;
 #define ASYNC_TASK_TIMEOUT 15.0f
 typedef FOnlineKeyValuePairs<FString, FString> FSteamSessionKeyValuePairs;
 
+/** Fired for every lobby parsed into the search results while a streaming lobby search is still running */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLobbySearchResultReceived, const FOnlineSessionSearchResult& /* SearchResult */);
+typedef FOnLobbySearchResultReceived::FDelegate FOnLobbySearchResultReceivedDelegate;
+
 #if WITH_STEAMCORE
 class ONLINESUBSYSTEMSTEAMCORE_API FOnlineSessionSteamCore : public IOnlineSession
 {
@@ -37,12 +41,14 @@ private:
 		  m_bSteamworksGameServerConnected(false),
 		  m_GameServerSteamId(nullptr),
 		  m_bPolicyResponseReceived(false),
-		  m_CurrentSessionSearch(nullptr)
+		  m_CurrentSessionSearch(nullptr),
+		  m_bStreamingLobbySearch(false)
 	{
 	}
 
 	void TickLanTasks(float DeltaTime) const;
 	void TickPendingInvites(float DeltaTime);
+	void TickPendingLobbyUpdates(float DeltaTime);
 
 	uint32 CreateLobbySession(int32 HostingPlayerNum, class FNamedOnlineSession* Session) const;
 	uint32 CreateInternetSession(int32 HostingPlayerNum, class FNamedOnlineSession* Session);
@@ -54,6 +60,9 @@ private:
 	uint32 DestroyLobbySession(class FNamedOnlineSession* Session, const FOnDestroySessionCompleteDelegate& CompletionDelegate) const;
 	uint32 DestroyInternetSession(class FNamedOnlineSession* Session, const FOnDestroySessionCompleteDelegate& CompletionDelegate) const;
 
+	void QueueLobbyUpdate(FName SessionName, const FOnlineSessionSettings& UpdatedSessionSettings, bool bShouldRefreshOnlineData);
+	void CancelPendingLobbyUpdate(FName SessionName);
+
 	uint32 CreateLANSession(int32 HostingPlayerNum, class FNamedOnlineSession* Session);
 	static uint32 JoinLANSession(int32 PlayerNum, class FNamedOnlineSession* Session, const class FOnlineSession* SearchSession);
 
@@ -63,8 +72,15 @@ private:
 	void AppendSessionToPacket(class FNboSerializeToBufferSteamCore& Packet, class FOnlineSession* Session) const;
 	static void AppendSessionSettingsToPacket(class FNboSerializeToBufferSteamCore& Packet, FOnlineSessionSettings* SessionSettings);
 
-	void ReadSessionFromPacket(class FNboSerializeFromBufferSteamCore& Packet, class FOnlineSession* Session) const;
-	static void ReadSettingsFromPacket(class FNboSerializeFromBufferSteamCore& Packet, FOnlineSessionSettings& SessionSettings);
+	/**
+	* Returns a copy of the session's advertisement as sent after the beacon header, built by AppendSessionToPacket and cached until the session changes.
+	* A copy because the cache lives under m_SessionLock. Empty if the session doesn't fit in a beacon packet, nothing is cached then.
+	*/
+	TArray<uint8> GetLanAdvertisement(class FNamedOnlineSession& Session);
+	void InvalidateLanAdvertisement(FName SessionName);
+
+	bool ReadSessionFromPacket(class FNboSerializeFromBufferSteamCore& Packet, class FOnlineSession* Session) const;
+	static bool ReadSettingsFromPacket(class FNboSerializeFromBufferSteamCore& Packet, FOnlineSessionSettings& SessionSettings);
 
 	void OnValidQueryPacketReceived(uint8* PacketData, int32 PacketLength, uint64 ClientNonce);
 	void OnValidResponsePacketReceived(uint8* PacketData, int32 PacketLength);
@@ -80,7 +96,8 @@ PACKAGE_SCOPE:
 		  m_bSteamworksGameServerConnected(false),
 		  m_GameServerSteamId(nullptr),
 		  m_bPolicyResponseReceived(false),
-		  m_CurrentSessionSearch(nullptr)
+		  m_CurrentSessionSearch(nullptr),
+		  m_bStreamingLobbySearch(false)
 	{
 	}
 	
@@ -97,6 +114,39 @@ PACKAGE_SCOPE:
 		}
 	};
 
+	/** UpdateSession calls on a lobby session that arrived inside the coalescing window and are flushed together when it ends */
+	struct FPendingLobbyUpdate
+	{
+		FOnlineSessionSettings m_Settings;
+		bool m_bUpdateOnlineData;
+		int32 m_NumUpdates;
+		double m_FlushTime;
+
+		FPendingLobbyUpdate()
+			: m_bUpdateOnlineData(false),
+			  m_NumUpdates(0),
+			  m_FlushTime(0.0)
+		{
+		}
+	};
+
+	struct FLanAdvertisement
+	{
+		TArray<uint8> m_Payload;
+		int32 m_NumOpenPublicConnections;
+		int32 m_NumOpenPrivateConnections;
+		int32 m_NumSettings;
+		double m_BuildTime;
+
+		FLanAdvertisement()
+			: m_NumOpenPublicConnections(0),
+			  m_NumOpenPrivateConnections(0),
+			  m_NumSettings(0),
+			  m_BuildTime(0.0)
+		{
+		}
+	};
+
 	void Tick(float DeltaTime);
 
 	virtual FNamedOnlineSession* AddNamedSession(FName SessionName, const FOnlineSessionSettings& SessionSettings) override
@@ -181,8 +231,17 @@ PACKAGE_SCOPE:
 	TSharedPtr<FOnlineSessionSearch> m_CurrentSessionSearch;
 	FPendingInviteData m_PendingInvite;
 	TArray<FUniqueNetIdSteamRef> m_PendingSearchLobbyIds;
+	bool m_bStreamingLobbySearch;
+	/** Lobbies parsed so far by a streaming search, read by the search task on the online thread */
+	FThreadSafeCounter m_NumStreamedSearchResults;
 	FCriticalSection m_JoinedLobbyLock;
 	TArray<FUniqueNetIdSteamRef> m_JoinedLobbyList;
+	TMap<FName, FPendingLobbyUpdate> m_PendingLobbyUpdates;
+	TMap<FName, double> m_LastLobbyUpdateTimes;
+	TMap<FName, FLanAdvertisement> m_LanAdvertisements;
+
+	/** Records a lobby data reply for the running search, parsing it straight into the results when the search streams */
+	void OnSearchLobbyDataReceived(const FUniqueNetIdSteamRef& LobbyId);
 
 public:
 	virtual ~FOnlineSessionSteamCore() override
@@ -212,6 +271,7 @@ public:
 			if (m_Sessions[SearchIndex].SessionName == SessionName)
 			{
 				m_Sessions.RemoveAtSwap(SearchIndex);
+				m_LanAdvertisements.Remove(SessionName);
 				return;
 			}
 		}
@@ -281,6 +341,8 @@ public:
 	virtual void UnregisterLocalPlayer(const FUniqueNetId& PlayerId, FName SessionName, const FOnUnregisterLocalPlayerCompleteDelegate& Delegate) override;
 	virtual int32 GetNumSessions() override;
 	virtual void DumpSessionState() override;
+
+	DEFINE_ONLINE_DELEGATE_ONE_PARAM(OnLobbySearchResultReceived, const FOnlineSessionSearchResult&);
 };
 
 typedef TSharedPtr<FOnlineSessionSteamCore, ESPMode::ThreadSafe> FOnlineSessionSteamCorePtr;
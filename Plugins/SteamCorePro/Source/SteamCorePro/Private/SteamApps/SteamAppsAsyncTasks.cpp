@@ -16,15 +16,15 @@ void FOnlineAsyncTaskSteamCoreProAppsGetFileDetails::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-	ISteamApps* SteamAppsPtr = GetApps();
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+	ISteamApps* SteamAppsPtr = GetApps();
+
 	if (SteamUtilsPtr && SteamAppsPtr)
 	{
 		if (!bInit)
@@ -37,13 +37,11 @@ void FOnlineAsyncTaskSteamCoreProAppsGetFileDetails::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				const bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -8,6 +8,7 @@
 #include "SteamCoreProPluginPrivatePCH.h"
 #include "SteamCoreProModule.h"
 #include "SteamCorePro/SteamTypes.h"
+#include "SteamCoreProCallResultDispatcher.h"
 
 void USteamCoreProAsyncAction::Activate()
 {
@@ -24,11 +25,17 @@ FOnlineAsyncTaskSteamCorePro::FOnlineAsyncTaskSteamCorePro()
 	: FOnlineAsyncTaskBasic(nullptr)
 	, bInit(false)
 	, bTimedOut(false)
+	, bCancelled(false)
 	, m_CallbackHandle(k_uAPICallInvalid)
 	, m_AsyncTimeout(10.f)
 {
 }
 
+FOnlineAsyncTaskSteamCorePro::~FOnlineAsyncTaskSteamCorePro()
+{
+	UnregisterCallResult();
+}
+
 void FOnlineAsyncTaskSteamCorePro::Tick()
 {
 	LogSteamCoreVerbose("Tick: %s", *ToString());
@@ -42,8 +49,61 @@ void FOnlineAsyncTaskSteamCorePro::Tick()
 			bIsComplete = true;
 			bWasSuccessful = false;
 
+			// The result buffer belongs to this task, so Steam must not write to it once the task gave up
+			UnregisterCallResult();
+
 			LogSteamCoreVerbose("%s timed out or finished ", *ToString());
 		}
 	}
 }
+
+void FOnlineAsyncTaskSteamCorePro::Cancel()
+{
+	LogSteamCoreVerbose("%s cancelled", *ToString());
+
+	bCancelled = true;
+	bIsComplete = true;
+	bWasSuccessful = false;
+	UnregisterCallResult();
+}
+
+bool FOnlineAsyncTaskSteamCorePro::GetCallResult(void* OutResult, int32 ResultSize, int32 CallbackId, bool& bOutFailed)
+{
+	if (m_ResultCall != m_CallbackHandle)
+	{
+		// A new call was issued, whatever was posted for the previous one does not answer it
+		UnregisterCallResult();
+		m_ResultCall = m_CallbackHandle;
+		m_bCallResultReady = false;
+		m_bCallResultFailed = false;
+
+		m_RegisteredCall = m_CallbackHandle;
+		FSteamCoreProCallResultDispatcher::Get().Register(m_CallbackHandle, CallbackId, ResultSize, OutResult, this);
+		return false;
+	}
+
+	if (m_bCallResultReady)
+	{
+		bOutFailed = m_bCallResultFailed;
+		return true;
+	}
+
+	return false;
+}
+
+void FOnlineAsyncTaskSteamCorePro::OnCallResult(bool bIOFailure)
+{
+	m_RegisteredCall = k_uAPICallInvalid;
+	m_bCallResultReady = true;
+	m_bCallResultFailed = bIOFailure;
+}
+
+void FOnlineAsyncTaskSteamCorePro::UnregisterCallResult()
+{
+	if (m_RegisteredCall != k_uAPICallInvalid)
+	{
+		FSteamCoreProCallResultDispatcher::Get().Unregister(m_RegisteredCall);
+		m_RegisteredCall = k_uAPICallInvalid;
+	}
+}
 #endif
@@ -0,0 +1,77 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+* Official SteamCorePro Documentation: https://eeldev.com
+*/
+
+#include "SteamCoreProCallResultDispatcher.h"
+#include "SteamCorePro/SteamCoreProAsync.h"
+#include "SteamCoreProPluginPrivatePCH.h"
+
+#if WITH_STEAMCORE
+FSteamCoreProCallResultDispatcher& FSteamCoreProCallResultDispatcher::Get()
+{
+	static FSteamCoreProCallResultDispatcher Dispatcher;
+	return Dispatcher;
+}
+
+void FSteamCoreProCallResultDispatcher::Register(SteamAPICall_t Call, int32 CallbackId, int32 ResultSize, void* Destination, FOnlineAsyncTaskSteamCorePro* Task)
+{
+	if (Call == k_uAPICallInvalid)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&m_Lock);
+
+	if (TUniquePtr<FPendingCall>* Existing = m_PendingCalls.Find(Call))
+	{
+		LogSteamCoreWarn("Call %llu already has a task waiting on it, replacing it", Call);
+		SteamAPI_UnregisterCallResult(Existing->Get(), Call);
+	}
+
+	TUniquePtr<FPendingCall>& Pending = m_PendingCalls.Add(Call, MakeUnique<FPendingCall>(*this, Call, CallbackId, ResultSize, Destination, Task));
+	SteamAPI_RegisterCallResult(Pending.Get(), Call);
+}
+
+void FSteamCoreProCallResultDispatcher::Unregister(SteamAPICall_t Call)
+{
+	FScopeLock Lock(&m_Lock);
+
+	TUniquePtr<FPendingCall> Pending;
+	if (m_PendingCalls.RemoveAndCopyValue(Call, Pending))
+	{
+		SteamAPI_UnregisterCallResult(Pending.Get(), Call);
+	}
+}
+
+int32 FSteamCoreProCallResultDispatcher::GetNumPending() const
+{
+	FScopeLock Lock(&m_Lock);
+	return m_PendingCalls.Num();
+}
+
+void FSteamCoreProCallResultDispatcher::FPendingCall::Run(void* Param, bool bIOFailure, SteamAPICall_t Call)
+{
+	// Steam has already dropped the registration, the dispatcher frees this object so nothing may touch it afterwards
+	m_Dispatcher.OnCallResult(m_Call, Param, bIOFailure);
+}
+
+void FSteamCoreProCallResultDispatcher::OnCallResult(SteamAPICall_t Call, void* Param, bool bIOFailure)
+{
+	FScopeLock Lock(&m_Lock);
+
+	TUniquePtr<FPendingCall> Pending;
+	if (!m_PendingCalls.RemoveAndCopyValue(Call, Pending))
+	{
+		return;
+	}
+
+	if (!bIOFailure && Param != nullptr)
+	{
+		FMemory::Memcpy(Pending->m_Destination, Param, Pending->m_ResultSize);
+	}
+
+	Pending->m_Task->OnCallResult(bIOFailure);
+}
+#endif
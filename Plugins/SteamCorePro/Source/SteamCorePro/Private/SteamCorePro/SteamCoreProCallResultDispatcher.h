@@ -0,0 +1,64 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+* Official SteamCorePro Documentation: https://eeldev.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamCorePro/Steam.h"
+
+#if WITH_STEAMCORE
+class FOnlineAsyncTaskSteamCorePro;
+
+/**
+* Routes Steam call results to the async tasks waiting on them.
+* Every pending call is registered with Steam's call result registry, so the result is copied into the task from inside
+* SteamAPI_RunCallbacks/SteamGameServer_RunCallbacks the moment it arrives. Tasks only read a flag while they wait instead
+* of asking Steam with IsAPICallCompleted every tick.
+*/
+class FSteamCoreProCallResultDispatcher
+{
+public:
+	static FSteamCoreProCallResultDispatcher& Get();
+
+	/** Copies the result of Call into Destination and notifies Task when Steam posts it. Destination must stay valid until then or until Unregister. */
+	void Register(SteamAPICall_t Call, int32 CallbackId, int32 ResultSize, void* Destination, FOnlineAsyncTaskSteamCorePro* Task);
+
+	/** Stops waiting for Call, a result arriving later is dropped by Steam */
+	void Unregister(SteamAPICall_t Call);
+
+	int32 GetNumPending() const;
+
+private:
+	class FPendingCall : public CCallbackBase
+	{
+	public:
+		FPendingCall(FSteamCoreProCallResultDispatcher& InDispatcher, SteamAPICall_t InCall, int32 InCallbackId, int32 InResultSize, void* InDestination, FOnlineAsyncTaskSteamCorePro* InTask)
+			: m_Dispatcher(InDispatcher)
+			, m_Call(InCall)
+			, m_ResultSize(InResultSize)
+			, m_Destination(InDestination)
+			, m_Task(InTask)
+		{
+			m_iCallback = InCallbackId;
+		}
+
+		virtual void Run(void* Param) override {}
+		virtual void Run(void* Param, bool bIOFailure, SteamAPICall_t Call) override;
+		virtual int GetCallbackSizeBytes() override { return m_ResultSize; }
+
+		FSteamCoreProCallResultDispatcher& m_Dispatcher;
+		SteamAPICall_t m_Call;
+		int32 m_ResultSize;
+		void* m_Destination;
+		FOnlineAsyncTaskSteamCorePro* m_Task;
+	};
+
+	void OnCallResult(SteamAPICall_t Call, void* Param, bool bIOFailure);
+
+	mutable FCriticalSection m_Lock;
+	TMap<SteamAPICall_t, TUniquePtr<FPendingCall>> m_PendingCalls;
+};
+#endif
@@ -42,28 +42,69 @@ void FSteamCoreProModule::ShutdownModule()
 
 IMPLEMENT_MODULE(FSteamCoreProModule, SteamCorePro)
 
-void USteamCoreInterface::QueueAsyncTask(FOnlineAsyncTask* AsyncTask)
+// Front-end flows wait on lobbies and servers, stats sync can trail behind everything else
+static ESteamCoreAsyncTaskPriority GetDefaultAsyncTaskPriority(ESteamCoreAsyncTaskCategory Category)
+{
+	switch (Category)
+	{
+	case ESteamCoreAsyncTaskCategory::Session:
+	case ESteamCoreAsyncTaskCategory::Lobby:
+	case ESteamCoreAsyncTaskCategory::ServerBrowser:
+		return ESteamCoreAsyncTaskPriority::High;
+	case ESteamCoreAsyncTaskCategory::Stats:
+		return ESteamCoreAsyncTaskPriority::Low;
+	default:
+		return ESteamCoreAsyncTaskPriority::Normal;
+	}
+}
+
+static uint32 ScheduleSteamCoreAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority)
 {
 #if WITH_STEAMCORE
 	FOnlineSubsystemSteamCore* SteamCoreOSS = static_cast<FOnlineSubsystemSteamCore*>(IOnlineSubsystem::Get(STEAMCORE_SUBSYSTEM));
 	
 	if (SteamCoreOSS)
 	{
-		SteamCoreOSS->QueueAsyncTask(AsyncTask);
+		return SteamCoreOSS->ScheduleAsyncTask(AsyncTask, Category, Priority, [AsyncTask]()
+		{
+			AsyncTask->Cancel();
+		});
 	}
 #endif
+	return 0;
+}
+
+uint32 USteamCoreInterface::QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category)
+{
+	return ScheduleSteamCoreAsyncTask(AsyncTask, Category, GetDefaultAsyncTaskPriority(Category));
+}
+
+uint32 USteamCoreInterface::QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority)
+{
+	return ScheduleSteamCoreAsyncTask(AsyncTask, Category, Priority);
+}
+
+uint32 USteamCoreProSubsystem::QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category)
+{
+	return ScheduleSteamCoreAsyncTask(AsyncTask, Category, GetDefaultAsyncTaskPriority(Category));
+}
+
+uint32 USteamCoreProSubsystem::QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority)
+{
+	return ScheduleSteamCoreAsyncTask(AsyncTask, Category, Priority);
 }
 
-void USteamCoreProSubsystem::QueueAsyncTask(FOnlineAsyncTask* AsyncTask)
+bool USteamCoreProSubsystem::CancelAsyncTask(uint32 Handle)
 {
 #if WITH_STEAMCORE
 	FOnlineSubsystemSteamCore* SteamCoreOSS = static_cast<FOnlineSubsystemSteamCore*>(IOnlineSubsystem::Get(STEAMCORE_SUBSYSTEM));
 	
 	if (SteamCoreOSS)
 	{
-		SteamCoreOSS->QueueAsyncTask(AsyncTask);
+		return SteamCoreOSS->CancelAsyncTask(Handle);
 	}
 #endif
+	return false;
 }
 
 USteamCoreProSubsystem* USteamCoreProSubsystem::Get()
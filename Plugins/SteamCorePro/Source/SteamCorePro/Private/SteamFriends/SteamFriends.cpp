@@ -211,7 +211,7 @@ void USteamProFriends::DownloadClanActivityCounts(const FOnDownloadClanActivityC
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProFriendsDownloadClanActivityCounts* Task = new FOnlineAsyncTaskSteamCoreProFriendsDownloadClanActivityCounts(Callback, SteamIDClans);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -224,7 +224,7 @@ void USteamProFriends::EnumerateFollowingList(const FOnEnumerateFollowingList& C
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProFriendsEnumerateFollowingList* Task = new FOnlineAsyncTaskSteamCoreProFriendsEnumerateFollowingList(Callback, StartIndex);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -459,7 +459,7 @@ void USteamProFriends::GetFollowerCount(const FOnGetFollowerCount& Callback, FSt
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProFriendsGetFollowerCount* Task = new FOnlineAsyncTaskSteamCoreProFriendsGetFollowerCount(Callback, SteamID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -1078,7 +1078,7 @@ void USteamProFriends::IsFollowing(const FOnIsFollowing& Callback, FSteamID Stea
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProFriendsIsFollowing* Task = new FOnlineAsyncTaskSteamCoreProFriendsIsFollowing(Callback, SteamID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -1107,7 +1107,7 @@ void USteamProFriends::JoinClanChatRoom(const FOnJoinClanChatRoom& Callback, FSt
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProFriendsJoinClanChatRoom* Task = new FOnlineAsyncTaskSteamCoreProFriendsJoinClanChatRoom(Callback, SteamIDClan);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -1163,7 +1163,7 @@ void USteamProFriends::RequestClanOfficerList(const FOnRequestClanOfficerList& C
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProRequestClanOfficerList* Task = new FOnlineAsyncTaskSteamCoreProRequestClanOfficerList(Callback, SteamIDClan);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -1248,7 +1248,7 @@ void USteamProFriends::SetPersonaName(const FOnSetPersonaName& Callback, FString
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProFriendsSetPersonaName* Task = new FOnlineAsyncTaskSteamCoreProFriendsSetPersonaName(Callback, Name);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
@@ -1297,7 +1297,7 @@ void USteamProFriends::RequestEquippedProfileItems(const FOnRequestEquippedProfi
 	if (SteamFriends())
 	{
 		FOnlineAsyncTaskSteamCoreProRequestEquippedProfileItems* Task = new FOnlineAsyncTaskSteamCoreProRequestEquippedProfileItems(Callback, SteamID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 	}
 #endif
 }
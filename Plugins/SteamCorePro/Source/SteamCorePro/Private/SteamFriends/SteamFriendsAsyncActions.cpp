@@ -22,7 +22,7 @@ USteamCoreProFriendsAsyncActionSetPersonaName* USteamCoreProFriendsAsyncActionSe
 		const auto Task = new FOnlineAsyncTaskSteamCoreProFriendsSetPersonaName(AsyncObject, Name, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -60,7 +60,7 @@ USteamCoreProFriendsAsyncActionDownloadClanActivityCounts* USteamCoreProFriendsA
 		const auto Task = new FOnlineAsyncTaskSteamCoreProFriendsDownloadClanActivityCounts(AsyncObject, SteamIDClans, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 
 		AsyncObject->Activate();
 
@@ -100,7 +100,7 @@ USteamCoreProFriendsAsyncActionRequestClanOfficerList* USteamCoreProFriendsAsync
 		const auto Task = new FOnlineAsyncTaskSteamCoreProRequestClanOfficerList(AsyncObject, SteamIDClan, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -138,7 +138,7 @@ USteamCoreProFriendsAsyncActionJoinClanChatRoom* USteamCoreProFriendsAsyncAction
 		const auto Task = new FOnlineAsyncTaskSteamCoreProFriendsJoinClanChatRoom(AsyncObject, SteamIDClan, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -176,7 +176,7 @@ USteamCoreProFriendsAsyncActionEnumerateFollowingList* USteamCoreProFriendsAsync
 		const auto Task = new FOnlineAsyncTaskSteamCoreProFriendsEnumerateFollowingList(AsyncObject, StartIndex, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -214,7 +214,7 @@ USteamCoreProFriendsAsyncActionIsFollowing* USteamCoreProFriendsAsyncActionIsFol
 		const auto Task = new FOnlineAsyncTaskSteamCoreProFriendsIsFollowing(AsyncObject, SteamID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -252,7 +252,7 @@ USteamCoreProFriendsAsyncActionGetFollowerCount* USteamCoreProFriendsAsyncAction
 		const auto Task = new FOnlineAsyncTaskSteamCoreProFriendsGetFollowerCount(AsyncObject, SteamID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Friends);
 		AsyncObject->Activate();
 
 		return AsyncObject;
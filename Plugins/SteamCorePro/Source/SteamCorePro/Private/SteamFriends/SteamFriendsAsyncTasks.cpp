@@ -16,14 +16,14 @@ void FOnlineAsyncTaskSteamCoreProFriendsSetPersonaName::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-	
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -36,13 +36,11 @@ void FOnlineAsyncTaskSteamCoreProFriendsSetPersonaName::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_bSuccess) ? true : false) && ((m_CallbackResults.m_bLocalSuccess ? true : false));
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_bSuccess) ? true : false) && ((m_CallbackResults.m_bLocalSuccess ? true : false));
 			}
 		}
 		else
@@ -74,14 +72,14 @@ void FOnlineAsyncTaskSteamCoreProFriendsDownloadClanActivityCounts::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-	
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -102,13 +100,11 @@ void FOnlineAsyncTaskSteamCoreProFriendsDownloadClanActivityCounts::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_bSuccess) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_bSuccess) ? true : false);
 			}
 		}
 		else
@@ -140,14 +136,14 @@ void FOnlineAsyncTaskSteamCoreProRequestClanOfficerList::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -160,13 +156,11 @@ void FOnlineAsyncTaskSteamCoreProRequestClanOfficerList::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_bSuccess) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_bSuccess) ? true : false);
 			}
 		}
 		else
@@ -198,14 +192,14 @@ void FOnlineAsyncTaskSteamCoreProFriendsJoinClanChatRoom::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -218,13 +212,11 @@ void FOnlineAsyncTaskSteamCoreProFriendsJoinClanChatRoom::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false);
 			}
 		}
 		else
@@ -256,14 +248,14 @@ void FOnlineAsyncTaskSteamCoreProFriendsEnumerateFollowingList::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -276,13 +268,11 @@ void FOnlineAsyncTaskSteamCoreProFriendsEnumerateFollowingList::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -314,14 +304,14 @@ void FOnlineAsyncTaskSteamCoreProFriendsIsFollowing::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -334,13 +324,11 @@ void FOnlineAsyncTaskSteamCoreProFriendsIsFollowing::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -372,14 +360,14 @@ void FOnlineAsyncTaskSteamCoreProFriendsGetFollowerCount::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -392,13 +380,11 @@ void FOnlineAsyncTaskSteamCoreProFriendsGetFollowerCount::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -426,14 +412,14 @@ void FOnlineAsyncTaskSteamCoreProRequestEquippedProfileItems::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -446,13 +432,11 @@ void FOnlineAsyncTaskSteamCoreProRequestEquippedProfileItems::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -16,14 +16,14 @@ void FOnlineAsyncTaskSteamCoreProGameServerAssociateWithClan::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -36,13 +36,11 @@ void FOnlineAsyncTaskSteamCoreProGameServerAssociateWithClan::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				const bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -74,14 +72,14 @@ void FOnlineAsyncTaskSteamCoreProGameServerComputeNewPlayerCompatibility::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+
 	if (SteamUtilsPtr)
 	{
 		if (!bInit)
@@ -94,13 +92,11 @@ void FOnlineAsyncTaskSteamCoreProGameServerComputeNewPlayerCompatibility::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				const bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_eResult == k_EResultOK) ? true : false);
 			}
 		}
 		else
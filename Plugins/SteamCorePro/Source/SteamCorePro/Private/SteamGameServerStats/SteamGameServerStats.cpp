@@ -223,7 +223,7 @@ void USteamProGameServerStats::ServerRequestUserStats(const FOnServerRequestUser
 	if (SteamGameServerStats())
 	{
 		FOnlineAsyncTaskSteamCoreProGameServerStatsUserStatsGS* Task = new FOnlineAsyncTaskSteamCoreProGameServerStatsUserStatsGS(Callback, SteamIDUser);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -241,7 +241,7 @@ void USteamProGameServerStats::ServerStoreUserStats(const FOnServerStoreUserStat
 	if (SteamGameServerStats())
 	{
 		FOnlineAsyncTaskSteamCoreProGameServerStatsStoreUserStats* Task = new FOnlineAsyncTaskSteamCoreProGameServerStatsStoreUserStats(Callback, SteamIDUser);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -335,7 +335,7 @@ void USteamProInventory::StartPurchase(const FOnSteamInventoryStartPurchaseResul
 	if (GetInventory())
 	{
 		FOnlineAsyncTaskSteamCoreProInventoryStartPurchaseResult* Task = new FOnlineAsyncTaskSteamCoreProInventoryStartPurchaseResult(Callback, ItemDefs, Quantity);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Inventory);
 	}
 #endif
 }
@@ -836,7 +836,7 @@ void USteamProInventory::RequestEligiblePromoItemDefinitionsIDs(const FOnRequest
 	if (GetInventory())
 	{
 		FOnlineAsyncTaskSteamCoreProInventoryRequestEligiblePromoItemDefinitionsIDs* Task = new FOnlineAsyncTaskSteamCoreProInventoryRequestEligiblePromoItemDefinitionsIDs(Callback, SteamID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Inventory);
 	}
 #endif
 }
@@ -849,7 +849,7 @@ void USteamProInventory::RequestPrices(const FOnSteamInventoryRequestPricesResul
 	if (GetInventory())
 	{
 		FOnlineAsyncTaskSteamCoreProInventoryRequestPricesResult* Task = new FOnlineAsyncTaskSteamCoreProInventoryRequestPricesResult(Callback);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Inventory);
 	}
 #endif
 }
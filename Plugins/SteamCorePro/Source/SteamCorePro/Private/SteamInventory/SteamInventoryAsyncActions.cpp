@@ -23,7 +23,7 @@ USteamCoreProInventoryAsyncActionRequestEligiblePromoItemDefinitionsIDs* USteamC
 		const auto Task = new FOnlineAsyncTaskSteamCoreProInventoryRequestEligiblePromoItemDefinitionsIDs(AsyncObject, SteamID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Inventory);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -61,7 +61,7 @@ USteamCoreProInventoryAsyncActionRequestPricesResult* USteamCoreProInventoryAsyn
 		const auto Task = new FOnlineAsyncTaskSteamCoreProInventoryRequestPricesResult(AsyncObject, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Inventory);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -96,7 +96,7 @@ USteamCoreProInventoryAsyncActionStartPurchaseResult* USteamCoreProInventoryAsyn
 		const auto Task = new FOnlineAsyncTaskSteamCoreProInventoryStartPurchaseResult(AsyncObject, ItemDefs, Quantity, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Inventory);
 		AsyncObject->Activate();
 
 		return AsyncObject;
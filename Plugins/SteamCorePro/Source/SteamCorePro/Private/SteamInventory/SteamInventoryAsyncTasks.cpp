@@ -16,15 +16,15 @@ void FOnlineAsyncTaskSteamCoreProInventoryRequestEligiblePromoItemDefinitionsIDs
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-	ISteamInventory* SteamInventoryPtr = GetInventory();
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+	ISteamInventory* SteamInventoryPtr = GetInventory();
+
 	if (SteamUtilsPtr && SteamInventoryPtr)
 	{
 		if (!bInit)
@@ -37,13 +37,11 @@ void FOnlineAsyncTaskSteamCoreProInventoryRequestEligiblePromoItemDefinitionsIDs
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_result == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_result == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -75,15 +73,15 @@ void FOnlineAsyncTaskSteamCoreProInventoryRequestPricesResult::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-	ISteamInventory* SteamInventoryPtr = GetInventory();
-
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+	ISteamInventory* SteamInventoryPtr = GetInventory();
+
 	if (SteamUtilsPtr && SteamInventoryPtr)
 	{
 		if (!bInit)
@@ -96,13 +94,11 @@ void FOnlineAsyncTaskSteamCoreProInventoryRequestPricesResult::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_result == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_result == k_EResultOK) ? true : false);
 			}
 		}
 		else
@@ -134,15 +130,15 @@ void FOnlineAsyncTaskSteamCoreProInventoryStartPurchaseResult::Tick()
 {
 	FOnlineAsyncTaskSteamCorePro::Tick();
 
-	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
-	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
-	ISteamInventory* SteamInventoryPtr = GetInventory();
-	
-	if (bIsComplete)
+	if (bIsComplete || IsWaitingForCallResult())
 	{
 		return;
 	}
 
+	ISteamUtils* SteamUtilsPtr = IsRunningDedicatedServer() ? SteamGameServerUtils() : SteamUtils();
+	checkf(SteamUtilsPtr, TEXT("Steam API not found, make sure your Steam Client is running and that the Steam API was loaded."));
+	ISteamInventory* SteamInventoryPtr = GetInventory();
+
 	if (SteamUtilsPtr && SteamInventoryPtr)
 	{
 		if (!bInit)
@@ -169,13 +165,11 @@ void FOnlineAsyncTaskSteamCoreProInventoryStartPurchaseResult::Tick()
 		{
 			bool bFailedCall = false;
 
-			bIsComplete = SteamUtilsPtr->IsAPICallCompleted(m_CallbackHandle, &bFailedCall) ? true : false;
+			bIsComplete = GetCallResult(m_CallbackResults, bFailedCall);
 
 			if (bIsComplete)
 			{
-				bool bFailedResult;
-				bool bSuccessCallResult = SteamUtilsPtr->GetAPICallResult(m_CallbackHandle, &m_CallbackResults, sizeof(m_CallbackResults), m_CallbackResults.k_iCallback, &bFailedResult);
-				bWasSuccessful = (bSuccessCallResult ? true : false) && (!bFailedCall ? true : false) && (!bFailedResult ? true : false) && ((m_CallbackResults.m_result == k_EResultOK) ? true : false);
+				bWasSuccessful = (!bFailedCall ? true : false) && ((m_CallbackResults.m_result == k_EResultOK) ? true : false);
 			}
 		}
 		else
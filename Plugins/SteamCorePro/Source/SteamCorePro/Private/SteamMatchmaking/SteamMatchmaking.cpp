@@ -191,7 +191,7 @@ void USteamProMatchmaking::CreateLobby(const FOnCreateLobby& Callback, ESteamLob
 	if (SteamMatchmaking())
 	{
 		FOnlineAsyncTaskSteamCoreProMatchmakingCreateLobby* Task = new FOnlineAsyncTaskSteamCoreProMatchmakingCreateLobby(Callback, static_cast<ELobbyType>(LobbyType), MaxMembers);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Lobby);
 	}
 #endif
 }
@@ -528,7 +528,7 @@ void USteamProMatchmaking::JoinLobby(const FOnJoinLobby& Callback, FSteamID Stea
 	if (SteamMatchmaking())
 	{
 		FOnlineAsyncTaskSteamCoreProJoinLobby* Task = new FOnlineAsyncTaskSteamCoreProJoinLobby(Callback, SteamIDLobby);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Lobby);
 	}
 #endif
 }
@@ -595,7 +595,7 @@ void USteamProMatchmaking::RequestLobbyList(const FOnRequestLobbyList& Callback)
 	if (SteamMatchmaking())
 	{
 		FOnlineAsyncTaskSteamCoreProRequestLobbyList* Task = new FOnlineAsyncTaskSteamCoreProRequestLobbyList(Callback);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Lobby);
 	}
 #endif
 }
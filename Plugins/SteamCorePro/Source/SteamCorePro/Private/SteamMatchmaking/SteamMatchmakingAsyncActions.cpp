@@ -24,7 +24,7 @@ USteamCoreProMatchmakingAsyncActionCreateLobby* USteamCoreProMatchmakingAsyncAct
 		const auto Task = new FOnlineAsyncTaskSteamCoreProMatchmakingCreateLobby(AsyncObject, static_cast<ELobbyType>(LobbyType), MaxMembers, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Lobby);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -62,7 +62,7 @@ USteamCoreProMatchmakingAsyncActionRequestLobbyList* USteamCoreProMatchmakingAsy
 		const auto Task = new FOnlineAsyncTaskSteamCoreProRequestLobbyList(AsyncObject, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Lobby);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -100,7 +100,7 @@ USteamCoreProMatchmakingAsyncActionJoinLobby* USteamCoreProMatchmakingAsyncActio
 		const auto Task = new FOnlineAsyncTaskSteamCoreProJoinLobby(AsyncObject, SteamIDLobby, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Lobby);
 		AsyncObject->Activate();
 
 		return AsyncObject;
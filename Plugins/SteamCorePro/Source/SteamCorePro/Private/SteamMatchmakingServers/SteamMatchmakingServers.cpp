@@ -80,7 +80,7 @@ void USteamProMatchmakingServers::PingServer(const FOnServerPing& Callback, FStr
 	if (SteamMatchmakingServers())
 	{
 		FOnlineAsyncTaskSteamCoreProMatchmakingServersPingServer* Task = new FOnlineAsyncTaskSteamCoreProMatchmakingServersPingServer(Callback, IP, Port);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::ServerBrowser);
 	}
 #endif
 }
@@ -93,7 +93,7 @@ void USteamProMatchmakingServers::ServerRules(const FOnServerRules& Callback, FS
 	if (SteamMatchmakingServers())
 	{
 		FOnlineAsyncTaskSteamCoreProMatchmakingServersServerRules* Task = new FOnlineAsyncTaskSteamCoreProMatchmakingServersServerRules(Callback, IP, Port);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::ServerBrowser);
 	}
 #endif
 }
@@ -106,7 +106,7 @@ void USteamProMatchmakingServers::RequestServerList(const FOnServerUpdated& Serv
 	if (SteamMatchmakingServers())
 	{
 		FOnlineAsyncTaskSteamCoreProMatchmakingServersServerList* Task = new FOnlineAsyncTaskSteamCoreProMatchmakingServersServerList(ServerCallback, AppID, Timeout, MaxResults, Type, bIgnoreNonResponsive, ServerFilter);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::ServerBrowser);
 	}
 #endif
 }
@@ -28,7 +28,7 @@ USteamCoreProMatchmakingServersAsyncActionPingServer* USteamCoreProMatchmakingSe
 		const auto Task = new FOnlineAsyncTaskSteamCoreProMatchmakingServersPingServer(AsyncObject, IP, Port, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::ServerBrowser);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -82,7 +82,7 @@ USteamCoreProMatchmakingServersAsyncActionRequestServerList* USteamCoreProMatchm
 		const auto Task = new FOnlineAsyncTaskSteamCoreProMatchmakingServersServerList(AsyncObject, AppID, Timeout, MaxResults, RequestType, bIgnoreNonResponsive, ServerFilter);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::ServerBrowser);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -179,7 +179,7 @@ USteamCoreProMatchmakingServersAsyncActionServerRules* USteamCoreProMatchmakingS
 		const auto Task = new FOnlineAsyncTaskSteamCoreProMatchmakingServersServerRules(AsyncObject, Ip, QueryPort, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::ServerBrowser);
 		AsyncObject->Activate();
 
 		return AsyncObject;
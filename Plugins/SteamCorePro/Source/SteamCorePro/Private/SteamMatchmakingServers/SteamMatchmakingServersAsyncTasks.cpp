@@ -139,7 +139,11 @@ void FOnlineAsyncTaskSteamCoreProMatchmakingServersServerList::Finalize()
 {
 	LogSteamCoreVerbose("");
 
-	CancelServerQuery();
+	// The request handle is shared, a task cancelled before it ran would release the one a newer search is using
+	if (!bCancelled)
+	{
+		CancelServerQuery();
+	}
 }
 
 void FOnlineAsyncTaskSteamCoreProMatchmakingServersServerList::CancelServerQuery()
@@ -134,7 +134,7 @@ void USteamProRemoteStorage::FileReadAsync(const FOnFileReadAsync& Callback, FSt
 	if (SteamRemoteStorage())
 	{
 		FOnlineAsyncTaskSteamCoreProRemoteStorageFileReadAsync* Task = new FOnlineAsyncTaskSteamCoreProRemoteStorageFileReadAsync(Callback, File, Offset, BytesToRead);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Storage);
 	}
 #endif
 }
@@ -167,7 +167,7 @@ void USteamProRemoteStorage::FileShare(const FOnFileShareAsync& Callback, FStrin
 	if (SteamRemoteStorage())
 	{
 		FOnlineAsyncTaskSteamCoreProRemoteStorageFileShare* Task = new FOnlineAsyncTaskSteamCoreProRemoteStorageFileShare(Callback, File);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Storage);
 	}
 #endif
 }
@@ -196,7 +196,7 @@ void USteamProRemoteStorage::FileWriteAsync(const FOnFileWriteAsync& Callback, F
 	if (SteamRemoteStorage())
 	{
 		FOnlineAsyncTaskSteamCoreProRemoteStorageFileWriteAsync* Task = new FOnlineAsyncTaskSteamCoreProRemoteStorageFileWriteAsync(Callback, File, Data);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Storage);
 	}
 #endif
 }
@@ -442,7 +442,7 @@ void USteamProRemoteStorage::UGCDownload(const FOnUGCDownloadAsync& Callback, FS
 	if (SteamRemoteStorage())
 	{
 		FOnlineAsyncTaskSteamCoreProRemoteStorageUGCDownload* Task = new FOnlineAsyncTaskSteamCoreProRemoteStorageUGCDownload(Callback, Content, Priority);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Storage);
 	}
 #endif
 }
@@ -474,7 +474,7 @@ void USteamProRemoteStorage::UGCDownloadToLocation(const FOnUGCDownloadToLocatio
 	if (SteamRemoteStorage())
 	{
 		FOnlineAsyncTaskSteamCoreProRemoteStorageUGCDownloadToLocation* Task = new FOnlineAsyncTaskSteamCoreProRemoteStorageUGCDownloadToLocation(Callback, Content, Location, Priority);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Storage);
 	}
 #endif
 }
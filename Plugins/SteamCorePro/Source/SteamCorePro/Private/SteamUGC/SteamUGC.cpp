@@ -59,7 +59,7 @@ void USteamProUGC::AddAppDependency(const FOnAddAppDependencyResult& Callback, F
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCAddAppDependency* Task = new FOnlineAsyncTaskSteamCoreProUGCAddAppDependency(Callback, PublishedFileID, AppId);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -72,7 +72,7 @@ void USteamProUGC::AddDependency(const FOnAddUGCDependencyResult& Callback, FPub
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCAddUGCDependency* Task = new FOnlineAsyncTaskSteamCoreProUGCAddUGCDependency(Callback, PublishedFileID, ChildPublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -157,7 +157,7 @@ void USteamProUGC::AddItemToFavorites(const FOnAddItemToFavorites& Callback, int
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCAddItemToFavorites* Task = new FOnlineAsyncTaskSteamCoreProUGCAddItemToFavorites(Callback, AppId, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -253,7 +253,7 @@ void USteamProUGC::CreateItem(const FOnCreateItem& Callback, int32 ConsumerAppID
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCCreateItem* Task = new FOnlineAsyncTaskSteamCoreProUGCCreateItem(Callback, ConsumerAppID, FileType);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -324,7 +324,7 @@ void USteamProUGC::DeleteItem(const FOnDeleteItemResult& Callback, FPublishedFil
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCDeleteItem* Task = new FOnlineAsyncTaskSteamCoreProUGCDeleteItem(Callback, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -353,7 +353,7 @@ void USteamProUGC::GetAppDependencies(const FOnGetAppDependenciesResult& Callbac
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCGetAppDependencies* Task = new FOnlineAsyncTaskSteamCoreProUGCGetAppDependencies(Callback, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -881,7 +881,7 @@ void USteamProUGC::GetUserItemVote(const FOnGetUserItemVote& Callback, FPublishe
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCGetUserItemVote* Task = new FOnlineAsyncTaskSteamCoreProUGCGetUserItemVote(Callback, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -910,7 +910,7 @@ void USteamProUGC::RemoveAppDependency(const FOnRemoveAppDependencyResult& Callb
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCRemoveAppDependency* Task = new FOnlineAsyncTaskSteamCoreProUGCRemoveAppDependency(Callback, PublishedFileID, AppId);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -923,7 +923,7 @@ void USteamProUGC::RemoveDependency(const FOnRemoveUGCDependencyResult& Callback
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCRemoveUGCDependency* Task = new FOnlineAsyncTaskSteamCoreProUGCRemoveUGCDependency(Callback, ParentPublishedFileID, ChildPublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -936,7 +936,7 @@ void USteamProUGC::RemoveItemFromFavorites(const FOnRemoveItemFromFavorites& Cal
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCRemoveItemFromFavorites* Task = new FOnlineAsyncTaskSteamCoreProUGCRemoveItemFromFavorites(Callback, AppId, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1013,7 +1013,7 @@ void USteamProUGC::SendQueryUGCRequest(const FOnSendQueryUGCRequest& Callback, F
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCSendQueryUGCRequest* Data = new FOnlineAsyncTaskSteamCoreProUGCSendQueryUGCRequest(Callback, Handle);
-		QueueAsyncTask(Data);
+		QueueAsyncTask(Data, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1412,7 +1412,7 @@ void USteamProUGC::SetUserItemVote(const FOnSetUserItemVote& Callback, FPublishe
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCSetUserItemVote* Task = new FOnlineAsyncTaskSteamCoreProUGCSetUserItemVote(Callback, bVoteUp, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1435,7 +1435,7 @@ void USteamProUGC::StartPlaytimeTracking(const FOnStartPlaytimeTracking& Callbac
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCStartPlaytimeTracking* Task = new FOnlineAsyncTaskSteamCoreProUGCStartPlaytimeTracking(Callback, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1448,7 +1448,7 @@ void USteamProUGC::StopPlaytimeTracking(const FOnStopPlaytimeTracking& Callback,
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCStopPlaytimeTracking* Task = new FOnlineAsyncTaskSteamCoreProUGCStopPlaytimeTracking(Callback, PublishedFileIDs);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1461,7 +1461,7 @@ void USteamProUGC::StopPlaytimeTrackingForAllItems(const FOnStopPlaytimeTracking
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCStopPlaytimeTrackingForAllItems* Task = new FOnlineAsyncTaskSteamCoreProUGCStopPlaytimeTrackingForAllItems(Callback);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1474,7 +1474,7 @@ void USteamProUGC::SubmitItemUpdate(const FOnSubmitItemUpdate& Callback, FUGCUpd
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCSubmitItemUpdate* Task = new FOnlineAsyncTaskSteamCoreProUGCSubmitItemUpdate(Callback, Handle, ChangeNote);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1487,7 +1487,7 @@ void USteamProUGC::SubscribeItem(const FOnSubscribeItem& Callback, FPublishedFil
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCSubscribeItem* Task = new FOnlineAsyncTaskSteamCoreProUGCSubscribeItem(Callback, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1512,7 +1512,7 @@ void USteamProUGC::UnsubscribeItem(const FOnUnsubscribeItem& Callback, FPublishe
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCUnsubscribeItem* Task = new FOnlineAsyncTaskSteamCoreProUGCUnsubscribeItem(Callback, PublishedFileID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -1573,7 +1573,7 @@ void USteamProUGC::GetWorkshopEULAStatus(const FOnGetWorkshopEULAStatus& Callbac
 	if (GetUGC())
 	{
 		FOnlineAsyncTaskSteamCoreProUGCGetWorkshopEULAStatus* Task = new FOnlineAsyncTaskSteamCoreProUGCGetWorkshopEULAStatus(Callback);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 	}
 #endif
 }
@@ -23,7 +23,7 @@ USteamCoreProUGCAsyncActionStopPlaytimeTrackingForAllItems* USteamCoreProUGCAsyn
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCStopPlaytimeTrackingForAllItems(AsyncObject, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -61,7 +61,7 @@ USteamCoreProUGCAsyncActionStopPlaytimeTracking* USteamCoreProUGCAsyncActionStop
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCStopPlaytimeTracking(AsyncObject, publishedFileIDs, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -99,7 +99,7 @@ USteamCoreProUGCAsyncActionStartPlaytimeTracking* USteamCoreProUGCAsyncActionSta
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCStartPlaytimeTracking(AsyncObject, publishedFileIDs, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -137,7 +137,7 @@ USteamCoreProUGCAsyncActionUnsubscribeItem* USteamCoreProUGCAsyncActionUnsubscri
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCUnsubscribeItem(AsyncObject, publishedFileIDs, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -175,7 +175,7 @@ USteamCoreProUGCAsyncActionSubscribeItem* USteamCoreProUGCAsyncActionSubscribeIt
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCSubscribeItem(AsyncObject, publishedFileIDs, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -213,7 +213,7 @@ USteamCoreProUGCAsyncActionRemoveItemFromFavorites* USteamCoreProUGCAsyncActionR
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCRemoveItemFromFavorites(AsyncObject, appID, publishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -251,7 +251,7 @@ USteamCoreProUGCAsyncActionAddItemToFavorites* USteamCoreProUGCAsyncActionAddIte
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCAddItemToFavorites(AsyncObject, appID, publishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -289,7 +289,7 @@ USteamCoreProUGCAsyncActionGetUserItemVote* USteamCoreProUGCAsyncActionGetUserIt
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCGetUserItemVote(AsyncObject, publishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -327,7 +327,7 @@ USteamCoreProUGCAsyncActionSetUserItemVote* USteamCoreProUGCAsyncActionSetUserIt
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCSetUserItemVote(AsyncObject, bVoteUp, publishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -365,7 +365,7 @@ USteamCoreProUGCAsyncActionSubmitItemUpdate* USteamCoreProUGCAsyncActionSubmitIt
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCSubmitItemUpdate(AsyncObject, Handle, ChangeNote, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -403,7 +403,7 @@ USteamCoreProUGCAsyncActionCreateItem* USteamCoreProUGCAsyncActionCreateItem::Cr
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCCreateItem(AsyncObject, ConsumerAppID, FileType, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -441,7 +441,7 @@ USteamCoreProUGCAsyncActionSendQueryUGCRequest* USteamCoreProUGCAsyncActionSendQ
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCSendQueryUGCRequest(AsyncObject, Handle, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -479,7 +479,7 @@ USteamCoreProUGCAsyncActionAddAppDependency* USteamCoreProUGCAsyncActionAddAppDe
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCAddAppDependency(AsyncObject, publishedFileID, appID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -517,7 +517,7 @@ USteamCoreProUGCAsyncActionRemoveAppDependency* USteamCoreProUGCAsyncActionRemov
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCRemoveAppDependency(AsyncObject, publishedFileID, appID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -555,7 +555,7 @@ USteamCoreProUGCAsyncActionAddUGCDependency* USteamCoreProUGCAsyncActionAddUGCDe
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCAddUGCDependency(AsyncObject, publishedFileID, ChildPublishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -593,7 +593,7 @@ USteamCoreProUGCAsyncActionRemoveUGCDependency* USteamCoreProUGCAsyncActionRemov
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCRemoveUGCDependency(AsyncObject, publishedFileID, ChildPublishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -631,7 +631,7 @@ USteamCoreProUGCAsyncActionDeleteItem* USteamCoreProUGCAsyncActionDeleteItem::De
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCDeleteItem(AsyncObject, publishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -669,7 +669,7 @@ USteamCoreProUGCAsyncActionGetAppDependencies* USteamCoreProUGCAsyncActionGetApp
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCGetAppDependencies(AsyncObject, publishedFileID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -707,7 +707,7 @@ USteamCoreProUGCAsyncActionDownloadItem* USteamCoreProUGCAsyncActionDownloadItem
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUGCDownloadItem(AsyncObject, publishedFileID, bHighPriority, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::UGC);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -62,7 +62,7 @@ void USteamProUserStats::AttachLeaderboardUGC(const FOnAttachLeaderboardUGC& Cal
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsAttachLeaderboardUGC* Task = new FOnlineAsyncTaskSteamCoreProUserStatsAttachLeaderboardUGC(Callback, SteamLeaderboard, Handle);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -91,7 +91,7 @@ void USteamProUserStats::DownloadLeaderboardEntries(const FOnDownloadLeaderboard
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsDownloadLeaderboardEntries* Task = new FOnlineAsyncTaskSteamCoreProUserStatsDownloadLeaderboardEntries(Callback, SteamLeaderboard, DataRequest, RangeStart, RangeEnd);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -104,7 +104,7 @@ void USteamProUserStats::DownloadLeaderboardEntriesForUsers(const FOnDownloadLea
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsDownloadLeaderboardEntriesForUsers* Task = new FOnlineAsyncTaskSteamCoreProUserStatsDownloadLeaderboardEntriesForUsers(Callback, SteamLeaderboard, Users);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -117,7 +117,7 @@ void USteamProUserStats::FindLeaderboard(const FOnFindLeaderboard& Callback, FSt
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsFindLeaderboard* Task = new FOnlineAsyncTaskSteamCoreProUserStatsFindLeaderboard(Callback, LeaderboardName);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -130,7 +130,7 @@ void USteamProUserStats::FindOrCreateLeaderboard(const FOnFindOrCreateLeaderboar
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsFindOrCreateLeaderboard* Task = new FOnlineAsyncTaskSteamCoreProUserStatsFindOrCreateLeaderboard(Callback, LeaderboardName, SortMethod, DisplayType);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -537,7 +537,7 @@ void USteamProUserStats::GetNumberOfCurrentPlayers(const FOnGetNumberOfCurrentPl
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsGetNumberOfCurrentPlayers* Task = new FOnlineAsyncTaskSteamCoreProUserStatsGetNumberOfCurrentPlayers(Callback);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -689,7 +689,7 @@ void USteamProUserStats::RequestGlobalAchievementPercentages(const FOnRequestGlo
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsRequestGlobalAchievementPercentages* Task = new FOnlineAsyncTaskSteamCoreProUserStatsRequestGlobalAchievementPercentages(Callback);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -702,7 +702,7 @@ void USteamProUserStats::RequestGlobalStats(const FOnRequestGlobalStats& Callbac
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsRequestGlobalStats* Task = new FOnlineAsyncTaskSteamCoreProUserStatsRequestGlobalStats(Callback, HistoryDays);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -715,7 +715,7 @@ void USteamProUserStats::RequestUserStats(const FOnRequestUserStats& Callback, F
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsRequestUserStats* Task = new FOnlineAsyncTaskSteamCoreProUserStatsRequestUserStats(Callback, SteamID);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
@@ -824,7 +824,7 @@ void USteamProUserStats::UploadLeaderboardScore(const FOnUploadLeaderboardScore&
 	if (SteamUserStats())
 	{
 		FOnlineAsyncTaskSteamCoreProUserStatsUploadLeaderboardScore* Task = new FOnlineAsyncTaskSteamCoreProUserStatsUploadLeaderboardScore(Callback, SteamLeaderboard, UploadScoreMethod, Score, ScoreDetails);
-		QueueAsyncTask(Task);
+		QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 	}
 #endif
 }
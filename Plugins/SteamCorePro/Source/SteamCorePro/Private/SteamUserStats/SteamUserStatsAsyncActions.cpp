@@ -23,7 +23,7 @@ USteamCoreProUserStatsAsyncActionFindLeaderboard* USteamCoreProUserStatsAsyncAct
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
 
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 
 		AsyncObject->Activate();
 
@@ -62,7 +62,7 @@ USteamCoreProUserStatsAsyncActionDownloadLeaderboardEntries* USteamCoreProUserSt
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsDownloadLeaderboardEntries(AsyncObject, SteamLeaderboard, dataRequest, RangeStart, RangeEnd, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -100,7 +100,7 @@ USteamCoreProUserStatsAsyncActionDownloadRequestGlobalStats* USteamCoreProUserSt
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsRequestGlobalStats(AsyncObject, HistoryDays, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -138,7 +138,7 @@ USteamCoreProUserStatsAsyncActionRequestGlobalAchievementPercentages* USteamCore
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsRequestGlobalAchievementPercentages(AsyncObject, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -177,7 +177,7 @@ USteamCoreProUserStatsAsyncActionGetNumberOfCurrentPlayers* USteamCoreProUserSta
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
 
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 
 		AsyncObject->Activate();
 
@@ -216,7 +216,7 @@ USteamCoreProUserStatsAsyncActionUploadLeaderboardScore* USteamCoreProUserStatsA
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsUploadLeaderboardScore(AsyncObject, SteamLeaderboard, UploadScoreMethod, Score, ScoreDetails, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -254,7 +254,7 @@ USteamCoreProUserStatsAsyncActionFindOrCreateLeaderboard* USteamCoreProUserStats
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsFindOrCreateLeaderboard(AsyncObject, LeaderboardName, SortMethod, DisplayType, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -292,7 +292,7 @@ USteamCoreProUserStatsAsyncActionRequestUserStats* USteamCoreProUserStatsAsyncAc
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsRequestUserStats(AsyncObject, SteamID, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -390,7 +390,7 @@ USteamCoreProUserStatsAsyncActionDownloadLeaderboardEntriesForUsers* USteamCoreP
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsDownloadLeaderboardEntriesForUsers(AsyncObject, SteamLeaderboard, Users, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -428,7 +428,7 @@ USteamCoreProUserStatsAsyncActionAttachLeaderboardUGC* USteamCoreProUserStatsAsy
 		const auto Task = new FOnlineAsyncTaskSteamCoreProUserStatsAttachLeaderboardUGC(AsyncObject, SteamLeaderboard, Handle, Timeout);
 		AsyncObject->RegisterWithGameInstance(WorldContextObject);
 		
-		Subsystem->QueueAsyncTask(Task);
+		Subsystem->QueueAsyncTask(Task, ESteamCoreAsyncTaskCategory::Stats);
 		AsyncObject->Activate();
 
 		return AsyncObject;
@@ -23,6 +23,7 @@ public:
 		: FOnlineAsyncTaskBasic(nullptr)
 		, bInit(false)
 		, bTimedOut(false)
+		, bCancelled(false)
 		, m_CallbackHandle(Handle)
 		, m_AsyncObject(nullptr)
 		, m_AsyncTimeout(Timeout)
@@ -33,28 +34,62 @@ public:
 		: FOnlineAsyncTaskBasic(nullptr)
 		, bInit(false)
 		, bTimedOut(false)
+		, bCancelled(false)
 		, m_CallbackHandle(Handle)
 		, m_AsyncObject(AsyncObject)
 		, m_AsyncTimeout(Timeout)
 	{
 	}
 
-	virtual ~FOnlineAsyncTaskSteamCorePro() override
-	{
-	}
+	virtual ~FOnlineAsyncTaskSteamCorePro() override;
 
 private:
 	FOnlineAsyncTaskSteamCorePro();
 public:
 	bool bInit;
 	bool bTimedOut;
+
+	/** Set when the task was cancelled before it started, it never called into Steam */
+	bool bCancelled;
 	SteamAPICall_t m_CallbackHandle;
 	USteamCoreProAsyncAction* m_AsyncObject;
+
+	/**
+	* Completes the task as failed without ticking it. Its delegates still fire, with bWasSuccessful false and the
+	* value initialized result the constructor left in m_CallbackResults.
+	*/
+	void Cancel();
 protected:
 	virtual void Tick() override;
 	virtual FString ToString() const override { return "SteamCoreProAyncTask"; }
+
+	/**
+	* Waits for the result of m_CallbackHandle through the call result dispatcher instead of polling Steam.
+	* Returns true once Steam has posted the result and it was copied into OutResult, bOutFailed is set on an IO failure.
+	*/
+	template <typename TResult>
+	bool GetCallResult(TResult& OutResult, bool& bOutFailed)
+	{
+		return GetCallResult(&OutResult, sizeof(TResult), TResult::k_iCallback, bOutFailed);
+	}
+	bool GetCallResult(void* OutResult, int32 ResultSize, int32 CallbackId, bool& bOutFailed);
+
+	/** True while the dispatcher waits on m_CallbackHandle, Tick returns before touching Steam until the result is in */
+	bool IsWaitingForCallResult() const { return m_RegisteredCall != k_uAPICallInvalid && m_RegisteredCall == m_CallbackHandle; }
 protected:
 	float m_AsyncTimeout = 10.f;
+private:
+	friend class FSteamCoreProCallResultDispatcher;
+	void OnCallResult(bool bIOFailure);
+	void UnregisterCallResult();
+
+	/** Call the dispatcher is waiting on for this task */
+	SteamAPICall_t m_RegisteredCall = k_uAPICallInvalid;
+
+	/** Call the ready and failed flags belong to, they are reset when m_CallbackHandle moves on */
+	SteamAPICall_t m_ResultCall = k_uAPICallInvalid;
+	bool m_bCallResultReady = false;
+	bool m_bCallResultFailed = false;
 };
 #endif
 
@@ -17,6 +17,7 @@ class USteamCoreProMatchmakingServersAsyncActionServerRules;
 class FOnlineAsyncTaskSteamCoreProMatchmakingServersPingServer;
 class FOnlineAsyncTaskSteamCoreProMatchmakingServersServerList;
 class FOnlineAsyncTaskSteamCoreProMatchmakingServersServerRules;
+class FOnlineAsyncTaskSteamCorePro;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSteamCorePro, Log, All);
 
@@ -45,7 +46,9 @@ public:
 	USteamCoreInterface() {};
 	virtual ~USteamCoreInterface() override {};
 
-	void QueueAsyncTask(class FOnlineAsyncTask* AsyncTask);
+	/** Schedules AsyncTask to run concurrently with other SteamCore tasks, returns a handle for CancelAsyncTask or 0 if Steam is unavailable */
+	uint32 QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category = ESteamCoreAsyncTaskCategory::General);
+	uint32 QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority);
 };
 
 UCLASS()
@@ -63,7 +66,12 @@ public:
 	USteamCoreProSubsystem() {};
 	virtual ~USteamCoreProSubsystem() override {};
 
-	void QueueAsyncTask(FOnlineAsyncTask* AsyncTask);
+	/** Schedules AsyncTask to run concurrently with other SteamCore tasks, returns a handle for CancelAsyncTask or 0 if Steam is unavailable */
+	uint32 QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category = ESteamCoreAsyncTaskCategory::General);
+	uint32 QueueAsyncTask(FOnlineAsyncTaskSteamCorePro* AsyncTask, ESteamCoreAsyncTaskCategory Category, ESteamCoreAsyncTaskPriority Priority);
+
+	/** Cancels a queued task that has not started yet, its callback fires with bWasSuccessful false */
+	bool CancelAsyncTask(uint32 Handle);
 
 	static USteamCoreProSubsystem* Get();
 
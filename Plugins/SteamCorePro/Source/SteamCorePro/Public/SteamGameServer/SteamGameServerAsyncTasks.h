@@ -49,6 +49,7 @@ public:
 	FOnlineAsyncTaskSteamCoreProGameServerComputeNewPlayerCompatibility(const FOnComputeNewPlayerCompatibility Callback, const FSteamID SteamIDNewPlayer, float Timeout = 10.f)
 		: FOnlineAsyncTaskSteamCorePro(k_uAPICallInvalid, Timeout)
 		  , m_OnSteamCallback(Callback)
+		  , m_CallbackResults()
 		  , m_SteamIDNewPlayer(SteamIDNewPlayer)
 	{
 	}
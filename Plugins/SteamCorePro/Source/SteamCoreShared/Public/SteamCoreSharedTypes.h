@@ -44,6 +44,31 @@ namespace FNetworkProtocolTypes
 	STEAMCORESHARED_API extern const FLazyName SteamCoreSocketsIP;
 }
 
+/** Groups of scheduled async tasks, each group has its own limit of tasks running at once */
+enum class ESteamCoreAsyncTaskCategory : uint8
+{
+	General,
+	Session,
+	Lobby,
+	/** Server list, ping and rules queries, these share state and always run one at a time */
+	ServerBrowser,
+	Leaderboard,
+	Stats,
+	UGC,
+	Storage,
+	Inventory,
+	Friends,
+	Count
+};
+
+/** Order in which waiting scheduled tasks are started, tasks of equal priority start in the order they were queued */
+enum class ESteamCoreAsyncTaskPriority : uint8
+{
+	Low,
+	Normal,
+	High
+};
+
 // lobby search distance. Lobby results are sorted from closest to farthest.
 UENUM(BlueprintType)
 enum class ESteamLobbyDistanceFilter : uint8
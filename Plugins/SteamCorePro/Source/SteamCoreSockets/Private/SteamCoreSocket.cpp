@@ -6,7 +6,9 @@
 #include "SteamCoreSocket.h"
 #include "SteamCoreSocketsTypes.h"
 #include "SteamCoreSocketsSubsystem.h"
+#include "SteamCoreSocketsTransport.h"
 #include "SteamCoreSocketsPrivate.h"
+#include "SteamCoreSocketsMessagePool.h"
 
 #if WITH_STEAMCORE
 
@@ -18,10 +20,13 @@ FSteamCoreSocket::FSteamCoreSocket(ESocketType InSocketType, const FString& InSo
 	  m_bIsListenSocket(false),
 	  m_bIsLANSocket(false),
 	  m_bHasPendingData(false),
-	  m_ClosureReason(k_ESteamNetConnectionEnd_App_Generic)
+	  m_ClosureReason(k_ESteamNetConnectionEnd_App_Generic),
+	  m_NumLanes(1)
 {
+	FMemory::Memzero(m_LaneBytesSent);
+	FMemory::Memzero(m_LanePacketsSent);
 	m_SocketSubsystem = static_cast<FSteamCoreSocketsSubsystem*>(ISocketSubsystem::Get(STEAMCORE_SOCKETS_SUBSYSTEM));
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 	m_PollGroup = k_HSteamNetPollGroup_Invalid;
 }
 
@@ -32,7 +37,7 @@ FSteamCoreSocket::~FSteamCoreSocket()
 		m_PendingData->Release();
 	}
 
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 	if (m_PollGroup != k_HSteamNetPollGroup_Invalid)
 	{
 		SocketInterface->DestroyPollGroup(m_PollGroup);
@@ -53,7 +58,7 @@ bool FSteamCoreSocket::Close()
 	}
 	STEAM_SDK_IGNORE_REDUNDANCY_END
 
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 
 	if (SocketInterface == nullptr)
 	{
@@ -99,7 +104,7 @@ bool FSteamCoreSocket::Bind(const FInternetAddr& Addr)
 
 bool FSteamCoreSocket::Connect(const FInternetAddr& Addr)
 {
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 
 	if (SocketInterface == nullptr)
 	{
@@ -141,7 +146,7 @@ bool FSteamCoreSocket::Connect(const FInternetAddr& Addr)
 
 bool FSteamCoreSocket::Listen(int32 MaxBacklog)
 {
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 
 	if (SocketInterface == nullptr)
 	{
@@ -215,31 +220,13 @@ bool FSteamCoreSocket::Send(const uint8* Data, int32 Count, int32& BytesSent)
 	BytesSent = 0;
 	if (m_InternalHandle != k_HSteamNetConnection_Invalid && GetConnectionState() == SCS_Connected)
 	{
-		switch (FSteamCoreSocketsSubsystem::GetSteamSocketsInterface()->SendMessageToConnection(m_InternalHandle, (void*)Data, Count, m_SendMode, nullptr))
+		const EResult Result = FSteamCoreSocketsSubsystem::GetTransport()->SendMessageToConnection(m_InternalHandle, (void*)Data, Count, m_SendMode, nullptr);
+		SetSendError(Result);
+		if (Result == k_EResultOK)
 		{
-		case k_EResultOK:
-			m_SocketSubsystem->m_LastSocketError = SE_NO_ERROR;
+			CountLaneSend(0, Count);
 			BytesSent = Count;
 			return true;
-			break;
-		case k_EResultInvalidParam:
-			m_SocketSubsystem->m_LastSocketError = SE_EINVAL;
-			break;
-		case k_EResultInvalidState:
-			m_SocketSubsystem->m_LastSocketError = SE_EBADF;
-			break;
-		case k_EResultNoConnection:
-			m_SocketSubsystem->m_LastSocketError = SE_ENOTCONN;
-			break;
-		case k_EResultIgnored:
-			m_SocketSubsystem->m_LastSocketError = SE_SYSNOTREADY;
-			break;
-		case k_EResultLimitExceeded:
-			m_SocketSubsystem->m_LastSocketError = SE_EPROCLIM;
-			break;
-		default:
-			m_SocketSubsystem->m_LastSocketError = SE_EFAULT;
-			break;
 		}
 		BytesSent = -1;
 	}
@@ -247,6 +234,122 @@ bool FSteamCoreSocket::Send(const uint8* Data, int32 Count, int32& BytesSent)
 	return false;
 }
 
+bool FSteamCoreSocket::SendOnLane(const uint8* Data, int32 Count, int32& BytesSent, uint16 Lane)
+{
+	if (Lane == 0)
+	{
+		return Send(Data, Count, BytesSent);
+	}
+
+	BytesSent = 0;
+	SteamNetworkingMessage_t* Message = AllocateSendMessage(Count, Lane);
+	if (Message == nullptr)
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Message->m_pData, Data, Count);
+	const uint16 MessageLane = Message->m_idxLane;
+
+	// SendMessages hands back a message number on success or a negated EResult
+	int64 Result = 0;
+	FSteamCoreSocketsSubsystem::GetTransport()->SendMessages(1, &Message, &Result);
+	if (Result < 0)
+	{
+		SetSendError(static_cast<EResult>(-Result));
+		BytesSent = -1;
+		return false;
+	}
+
+	CountLaneSend(MessageLane, Count);
+	BytesSent = Count;
+	return true;
+}
+
+void FSteamCoreSocket::SetSendError(EResult Result)
+{
+	switch (Result)
+	{
+	case k_EResultOK:
+		m_SocketSubsystem->m_LastSocketError = SE_NO_ERROR;
+		break;
+	case k_EResultInvalidParam:
+		m_SocketSubsystem->m_LastSocketError = SE_EINVAL;
+		break;
+	case k_EResultInvalidState:
+		m_SocketSubsystem->m_LastSocketError = SE_EBADF;
+		break;
+	case k_EResultNoConnection:
+		m_SocketSubsystem->m_LastSocketError = SE_ENOTCONN;
+		break;
+	case k_EResultIgnored:
+		m_SocketSubsystem->m_LastSocketError = SE_SYSNOTREADY;
+		break;
+	case k_EResultLimitExceeded:
+		m_SocketSubsystem->m_LastSocketError = SE_EPROCLIM;
+		break;
+	default:
+		m_SocketSubsystem->m_LastSocketError = SE_EFAULT;
+		break;
+	}
+}
+
+void FSteamCoreSocket::CountLaneSend(uint16 Lane, int32 Count)
+{
+	if (Lane < (uint16)ESteamCoreSocketsTrafficClass::Count)
+	{
+		m_LaneBytesSent[Lane] += Count;
+		m_LanePacketsSent[Lane]++;
+	}
+}
+
+SteamNetworkingMessage_t* FSteamCoreSocket::AllocateSendMessage(int32 Count, uint16 Lane)
+{
+	if (m_InternalHandle == k_HSteamNetConnection_Invalid || GetConnectionState() != SCS_Connected)
+	{
+		m_SocketSubsystem->m_LastSocketError = SE_ENOTCONN;
+		return nullptr;
+	}
+
+	SteamNetworkingMessage_t* Message = FSteamCoreSocketsMessagePool::AllocateMessage(Count);
+	if (Message == nullptr)
+	{
+		m_SocketSubsystem->m_LastSocketError = SE_ENOBUFS;
+		return nullptr;
+	}
+
+	Message->m_conn = m_InternalHandle;
+	Message->m_nFlags = m_SendMode;
+	Message->m_idxLane = (Lane < m_NumLanes) ? Lane : 0;
+	m_SocketSubsystem->m_LastSocketError = SE_NO_ERROR;
+	return Message;
+}
+
+bool FSteamCoreSocket::ConfigureLanes(int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights)
+{
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
+	if (m_InternalHandle == k_HSteamNetConnection_Invalid || SocketInterface == nullptr || m_bIsListenSocket)
+	{
+		return false;
+	}
+
+	// Steam refuses to remove lanes from a connection
+	if (NumLanes < m_NumLanes)
+	{
+		return false;
+	}
+
+	const EResult Result = SocketInterface->ConfigureConnectionLanes(m_InternalHandle, NumLanes, LanePriorities, LaneWeights);
+	if (Result != k_EResultOK)
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamSockets: Could not configure %d lanes on connection %u, got error %d"), NumLanes, m_InternalHandle, (int32)Result);
+		return false;
+	}
+
+	m_NumLanes = NumLanes;
+	return true;
+}
+
 bool FSteamCoreSocket::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketReceiveFlags::Type Flags)
 {
 	BytesRead = -1;
@@ -281,7 +384,7 @@ bool FSteamCoreSocket::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESo
 
 bool FSteamCoreSocket::RecvRaw(SteamNetworkingMessage_t*& Data, int32 MaxMessages, int32& MessagesRead, ESocketReceiveFlags::Type Flags)
 {
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 	if (SocketInterface == nullptr)
 	{
 		m_SocketSubsystem->m_LastSocketError = SE_SYSNOTREADY;
@@ -345,6 +448,53 @@ bool FSteamCoreSocket::RecvRaw(SteamNetworkingMessage_t*& Data, int32 MaxMessage
 	return false;
 }
 
+bool FSteamCoreSocket::RecvRawBatch(SteamNetworkingMessage_t** Messages, int32 MaxMessages, int32& MessagesRead)
+{
+	MessagesRead = 0;
+
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
+	if (SocketInterface == nullptr)
+	{
+		m_SocketSubsystem->m_LastSocketError = SE_SYSNOTREADY;
+		return false;
+	}
+
+	if (Messages == nullptr || MaxMessages <= 0 || m_InternalHandle == k_HSteamNetConnection_Invalid || (m_bIsListenSocket && m_InternalHandle == k_HSteamListenSocket_Invalid))
+	{
+		m_SocketSubsystem->m_LastSocketError = SE_EINVAL;
+		return false;
+	}
+
+	// A message left over from a peek is handed out first so ordering is preserved
+	int32 PendingRead = 0;
+	if (m_bHasPendingData && m_PendingData != nullptr)
+	{
+		Messages[0] = m_PendingData;
+		m_PendingData = nullptr;
+		m_bHasPendingData = false;
+		PendingRead = 1;
+
+		if (MaxMessages == 1)
+		{
+			MessagesRead = 1;
+			return true;
+		}
+	}
+
+	const int32 Received = (m_bIsListenSocket) ? SocketInterface->ReceiveMessagesOnPollGroup(m_PollGroup, Messages + PendingRead, MaxMessages - PendingRead) : SocketInterface->ReceiveMessagesOnConnection(m_InternalHandle, Messages + PendingRead, MaxMessages - PendingRead);
+	if (Received < 0)
+	{
+		UE_LOG(LogSockets, Error, TEXT("SteamSockets: RecvRawBatch Connection handle is marked as invalid! Is Listen Socket? %d"), m_bIsListenSocket);
+		MessagesRead = PendingRead;
+		m_SocketSubsystem->m_LastSocketError = SE_EFAULT;
+		return PendingRead > 0;
+	}
+
+	MessagesRead = PendingRead + Received;
+	m_SocketSubsystem->m_LastSocketError = SE_NO_ERROR;
+	return true;
+}
+
 bool FSteamCoreSocket::HasPendingData(uint32& PendingDataSize)
 {
 	if (m_bHasPendingData)
@@ -379,7 +529,7 @@ bool FSteamCoreSocket::HasPendingData(uint32& PendingDataSize)
 
 ESocketConnectionState FSteamCoreSocket::GetConnectionState()
 {
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 	if (m_InternalHandle == k_HSteamNetConnection_Invalid || SocketInterface == nullptr)
 	{
 		return SCS_NotConnected;
@@ -412,7 +562,7 @@ void FSteamCoreSocket::SetSendMode(int32 NewSendMode)
 
 bool FSteamCoreSocket::GetPeerAddress(FInternetAddr& OutAddr)
 {
-	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
 	FInternetAddrSteamCoreSockets& SteamAddr = (FInternetAddrSteamCoreSockets&)OutAddr;
 	SteamNetConnectionInfo_t CurrentConnectionInfo;
 	if (SocketInterface && SocketInterface->GetConnectionInfo(m_InternalHandle, &CurrentConnectionInfo))
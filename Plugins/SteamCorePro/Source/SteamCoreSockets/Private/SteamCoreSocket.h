@@ -9,6 +9,7 @@
 #include "SteamCoreSocketsPackage.h"
 #include "SteamCoreSocketsPrivate.h"
 #include "IPAddressSteamCoreSockets.h"
+#include "SteamCoreSocketsTypes.h"
 #include "Sockets.h"
 #include "SocketTypes.h"
 
@@ -27,9 +28,16 @@ PACKAGE_SCOPE:
 	ESteamNetConnectionEnd m_ClosureReason;
 	SteamNetworkingMessage_t* m_PendingData;
 
+	/** Lanes configured on the connection, lane N carries ESteamCoreSocketsTrafficClass N */
+	int32 m_NumLanes;
+	int64 m_LaneBytesSent[(int32)ESteamCoreSocketsTrafficClass::Count];
+	int64 m_LanePacketsSent[(int32)ESteamCoreSocketsTrafficClass::Count];
+
 	class FSteamCoreSocketsSubsystem* m_SocketSubsystem;
 
 	void SetLanOptions();
+	void SetSendError(EResult Result);
+	void CountLaneSend(uint16 Lane, int32 Count);
 
 public:
 	FSteamCoreSocket(ESocketType InSocketType, const FString& InSocketDescription, const FName& InSocketProtocol);
@@ -85,6 +93,21 @@ public:
 
 	bool RecvRaw(SteamNetworkingMessage_t*& Data, int32 MaxMessages, int32& MessagesRead, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None);
 
+	/** Receives up to MaxMessages messages into the Messages array with a single API call. The caller must release every message read. */
+	bool RecvRawBatch(SteamNetworkingMessage_t** Messages, int32 MaxMessages, int32& MessagesRead);
+
+	/** Allocates a pooled message addressed to this connection with Count bytes of payload, for the batched send path. Returns null if the socket cannot send. Lane stats are counted once the message has been sent. */
+	SteamNetworkingMessage_t* AllocateSendMessage(int32 Count, uint16 Lane = 0);
+
+	/** Like Send, on one of the lanes set up by ConfigureLanes */
+	bool SendOnLane(const uint8* Data, int32 Count, int32& BytesSent, uint16 Lane);
+
+	/** Sets up lane priorities and weights on the connection, lanes can only ever be added */
+	bool ConfigureLanes(int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights);
+
+	/** Lane that carries TrafficClass, lane 0 when the connection has no lane for it */
+	uint16 GetLaneForTrafficClass(ESteamCoreSocketsTrafficClass TrafficClass) const { return ((int32)TrafficClass < m_NumLanes) ? (uint16)TrafficClass : 0; }
+
 	void SetClosureReason(ESteamNetConnectionEnd NewClosureReason) { m_ClosureReason = NewClosureReason; }
 	void SetSendMode(int32 NewSendMode);
 };
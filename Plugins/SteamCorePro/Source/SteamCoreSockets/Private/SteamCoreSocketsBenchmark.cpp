@@ -0,0 +1,444 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#include "SteamCoreSocketsBenchmark.h"
+#include "SteamCoreSocketsBenchmarkConnection.h"
+#include "SteamCoreSocketsMessagePool.h"
+#include "SteamCoreSocketsNetDriver.h"
+#include "SteamCoreSocketsSubsystem.h"
+#include "SteamCoreSocket.h"
+#include "Engine/NetworkDelegates.h"
+#include "Misc/EngineVersionComparison.h"
+#include "PacketHandler.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+void USteamCoreSocketsBenchmarkConnection::ReceivedRawPacket(void* Data, int32 Count)
+{
+	if (!m_bCountReceivedPackets)
+	{
+		Super::ReceivedRawPacket(Data, Count);
+		return;
+	}
+
+	m_PacketsReceived++;
+	m_BytesReceived += Count;
+}
+
+#if WITH_STEAMCORE
+static constexpr int32 BenchmarkPort = 7777;
+
+/** Accepts every connection, the benchmark traffic never reaches the control channel */
+class FSteamCoreSocketsBenchmarkNotify : public FNetworkNotify
+{
+public:
+	virtual EAcceptConnection::Type NotifyAcceptingConnection() override { return EAcceptConnection::Accept; }
+	virtual void NotifyAcceptedConnection(UNetConnection* Connection) override {}
+	virtual bool NotifyAcceptingChannel(UChannel* Channel) override { return false; }
+	virtual void NotifyControlMessage(UNetConnection* Connection, uint8 MessageType, FInBunch& Bunch) override {}
+};
+
+struct FSteamCoreSocketsBenchmarkPeer
+{
+	USteamCoreSocketsBenchmarkConnection* Connection = nullptr;
+
+	/** Largest payload that fits in one packet next to the PacketHandler bits */
+	int32 MaxPayload = 1;
+
+	/** Fractional packets owed per traffic entry */
+	TArray<double> Owed;
+};
+
+static double GetPercentile(const TArray<double>& Sorted, float Percentile)
+{
+	if (Sorted.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
+static int64 GetNumMessageHeapAllocations()
+{
+	return FSteamCoreSocketsMessagePool::GetNumHeapAllocations() + FSteamCoreSocketsLoopbackTransport::GetNumHeapAllocations();
+}
+
+static USteamCoreSocketsNetDriver* CreateBenchmarkDriver(const FSteamCoreSocketsBenchmarkSettings& Settings)
+{
+	USteamCoreSocketsNetDriver* Driver = NewObject<USteamCoreSocketsNetDriver>(GetTransientPackage());
+	Driver->NetConnectionClassName = USteamCoreSocketsBenchmarkConnection::StaticClass()->GetPathName();
+	Driver->ReceiveBatchSize = FMath::Max(Settings.ReceiveBatchSize, 1);
+	Driver->bBatchOutgoingMessages = true;
+	Driver->bUseNetworkThread = false;
+	Driver->bUseConnectionLanes = false;
+	return Driver;
+}
+
+static bool IsBenchmarkConnectionReady(const UNetConnection* Connection)
+{
+	if (Connection == nullptr)
+	{
+		return false;
+	}
+
+#if UE_VERSION_OLDER_THAN(5,0,0)
+	const bool bIsOpen = Connection->State == USOCK_Open;
+#else
+	const bool bIsOpen = Connection->GetConnectionState() == USOCK_Open;
+#endif
+	return bIsOpen && (!Connection->Handler.IsValid() || Connection->Handler->IsFullyInitialized());
+}
+
+FSteamCoreSocketsBenchmarkSettings::FSteamCoreSocketsBenchmarkSettings()
+{
+	Transport.bManualClock = true;
+
+	FSteamCoreSocketsBenchmarkTraffic& Movement = Traffic.AddDefaulted_GetRef();
+	Movement.PacketSize = 64;
+	Movement.PacketsPerSecond = 30.0f;
+
+	FSteamCoreSocketsBenchmarkTraffic& Events = Traffic.AddDefaulted_GetRef();
+	Events.PacketSize = 960;
+	Events.PacketsPerSecond = 5.0f;
+}
+
+bool FSteamCoreSocketsBenchmarkSettings::ParseTrafficMix(const FString& Mix)
+{
+	TArray<FString> Entries;
+	Mix.ParseIntoArray(Entries, TEXT(","));
+
+	TArray<FSteamCoreSocketsBenchmarkTraffic> Parsed;
+	for (const FString& Entry : Entries)
+	{
+		TArray<FString> Fields;
+		Entry.ParseIntoArray(Fields, TEXT(":"));
+		if (Fields.Num() != 2)
+		{
+			return false;
+		}
+
+		FSteamCoreSocketsBenchmarkTraffic& Item = Parsed.AddDefaulted_GetRef();
+		Item.PacketSize = FCString::Atoi(*Fields[0]);
+		Item.PacketsPerSecond = FCString::Atof(*Fields[1]);
+
+		if (Item.PacketSize <= 0 || Item.PacketSize > k_cbMaxSteamNetworkingSocketsMessageSizeSend || Item.PacketsPerSecond <= 0.0f)
+		{
+			return false;
+		}
+	}
+
+	if (Parsed.Num() == 0)
+	{
+		return false;
+	}
+
+	Traffic = MoveTemp(Parsed);
+	return true;
+}
+
+FString FSteamCoreSocketsBenchmarkResult::ToString() const
+{
+	return FString::Printf(TEXT("Clients: %d Frames: %d Sent: %lld packets %lld bytes Received: %lld packets %lld bytes Packets/s: %.0f Bytes/s: %.0f Dispatch p50/p99: %.3f/%.3f ms Flush p50/p99: %.3f/%.3f ms Allocations/packet: %.4f"),
+		NumClients, NumFrames, PacketsSent, BytesSent, PacketsReceived, BytesReceived, PacketsPerSecond, BytesPerSecond,
+		DispatchP50Ms, DispatchP99Ms, FlushP50Ms, FlushP99Ms, AllocationsPerPacket);
+}
+
+FString FSteamCoreSocketsBenchmarkResult::ToJson() const
+{
+	// Flat numbers only, so building it by hand avoids pulling the Json module into the plugin
+	return FString::Printf(TEXT("{\"clients\":%d,\"frames\":%d,\"packetsSent\":%lld,\"bytesSent\":%lld,\"packetsReceived\":%lld,\"bytesReceived\":%lld,")
+		TEXT("\"workSeconds\":%.6f,\"packetsPerSecond\":%.1f,\"bytesPerSecond\":%.1f,\"dispatchP50Ms\":%.4f,\"dispatchP99Ms\":%.4f,")
+		TEXT("\"flushP50Ms\":%.4f,\"flushP99Ms\":%.4f,\"allocationsPerPacket\":%.6f}"),
+		NumClients, NumFrames, PacketsSent, BytesSent, PacketsReceived, BytesReceived,
+		WorkSeconds, PacketsPerSecond, BytesPerSecond, DispatchP50Ms, DispatchP99Ms,
+		FlushP50Ms, FlushP99Ms, AllocationsPerPacket);
+}
+
+FSteamCoreSocketsBenchmarkResult FSteamCoreSocketsBenchmark::Run(FSteamCoreSocketsSubsystem& Subsystem, const FSteamCoreSocketsBenchmarkSettings& Settings)
+{
+	FSteamCoreSocketsBenchmarkResult Result;
+	Result.NumClients = FMath::Max(Settings.NumClients, 1);
+	Result.NumFrames = FMath::Max(Settings.NumFrames, 1);
+
+	const float FrameSeconds = FMath::Max(Settings.FrameTimeMs, 0.1f) / 1000.0f;
+	const int32 NumTraffic = Settings.Traffic.Num();
+
+	// Handshake packets are unreliable and nothing ticks their resends, so link conditions only apply to the measured traffic
+	FSteamCoreSocketsLoopbackSettings HandshakeSettings;
+	HandshakeSettings.bManualClock = true;
+	HandshakeSettings.Seed = Settings.Transport.Seed;
+	TSharedRef<FSteamCoreSocketsLoopbackTransport, ESPMode::ThreadSafe> Transport = MakeShared<FSteamCoreSocketsLoopbackTransport, ESPMode::ThreadSafe>(HandshakeSettings);
+
+	const TSharedPtr<ISteamCoreSocketsTransport, ESPMode::ThreadSafe> PreviousTransport = Subsystem.m_Transport;
+	const bool bPreviousUseRelays = Subsystem.m_bUseRelays;
+	const bool bPreviousUseLoopbackTransport = Subsystem.m_bUseLoopbackTransport;
+	if (!Subsystem.SetTransport(Transport))
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Benchmark needs every SteamCoreSockets net driver to be shut down first"));
+		return Result;
+	}
+
+	FSteamCoreSocketsBenchmarkNotify Notify;
+	TArray<TStrongObjectPtr<USteamCoreSocketsNetDriver>> Drivers;
+	TArray<FSteamCoreSocketsBenchmarkPeer> Peers;
+
+	// Sockets the run created are the only ones the subsystem knows about, so all of them go before the transport is put back
+	auto TearDown = [&]()
+	{
+		for (TStrongObjectPtr<USteamCoreSocketsNetDriver>& Driver : Drivers)
+		{
+			Driver->Shutdown();
+			Driver->LowLevelDestroy();
+		}
+		Drivers.Reset();
+		Peers.Reset();
+
+		Transport->TakeStatusEvents();
+		Subsystem.CleanSocketInformation(true);
+		Subsystem.m_Transport = PreviousTransport;
+		Subsystem.m_bUseRelays = bPreviousUseRelays;
+		Subsystem.m_bUseLoopbackTransport = bPreviousUseLoopbackTransport;
+	};
+
+	FString Error;
+	USteamCoreSocketsNetDriver* ServerDriver = CreateBenchmarkDriver(Settings);
+	Drivers.Emplace(ServerDriver);
+
+	FURL ListenURL;
+	ListenURL.Port = BenchmarkPort;
+	if (!ServerDriver->InitListen(&Notify, ListenURL, false, Error))
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Benchmark server driver could not listen: %s"), *Error);
+		TearDown();
+		return Result;
+	}
+
+	FURL ConnectURL;
+	ConnectURL.Host = TEXT("127.0.0.1");
+	ConnectURL.Port = BenchmarkPort;
+	for (int32 Index = 0; Index < Result.NumClients; Index++)
+	{
+		USteamCoreSocketsNetDriver* ClientDriver = CreateBenchmarkDriver(Settings);
+		Drivers.Emplace(ClientDriver);
+		if (!ClientDriver->InitConnect(&Notify, ConnectURL, Error))
+		{
+			UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Benchmark client driver %d could not connect: %s"), Index, *Error);
+			TearDown();
+			return Result;
+		}
+	}
+
+	// Run frames until every Steam connection is open and every PacketHandler finished, the way a pending net game would
+	TArray<bool> HandshakeStarted;
+	HandshakeStarted.Init(false, Drivers.Num());
+	bool bAllReady = false;
+	for (int32 Frame = 0; Frame < FMath::Max(Settings.MaxHandshakeFrames, 1) && !bAllReady; Frame++)
+	{
+		Transport->DispatchStatusEvents(Subsystem);
+
+		bAllReady = ServerDriver->ClientConnections.Num() == Result.NumClients;
+		for (int32 DriverIdx = 1; DriverIdx < Drivers.Num(); DriverIdx++)
+		{
+			UNetConnection* ServerConnection = Drivers[DriverIdx]->ServerConnection;
+			if (!HandshakeStarted[DriverIdx] && ServerConnection != nullptr && !Drivers[DriverIdx]->ArePacketHandlersDisabled() && ServerConnection->Handler.IsValid())
+			{
+#if UE_VERSION_OLDER_THAN(5,0,0)
+				const bool bIsOpen = ServerConnection->State == USOCK_Open;
+#else
+				const bool bIsOpen = ServerConnection->GetConnectionState() == USOCK_Open;
+#endif
+				if (bIsOpen)
+				{
+					ServerConnection->Handler->BeginHandshaking();
+					HandshakeStarted[DriverIdx] = true;
+				}
+			}
+			bAllReady &= IsBenchmarkConnectionReady(ServerConnection);
+		}
+
+		for (UNetConnection* ClientConnection : ServerDriver->ClientConnections)
+		{
+			bAllReady &= IsBenchmarkConnectionReady(ClientConnection);
+		}
+
+		for (TStrongObjectPtr<USteamCoreSocketsNetDriver>& Driver : Drivers)
+		{
+			Driver->FlushOutgoingMessages();
+		}
+		Transport->AdvanceTime(FrameSeconds);
+		for (TStrongObjectPtr<USteamCoreSocketsNetDriver>& Driver : Drivers)
+		{
+			Driver->TickDispatch(FrameSeconds);
+		}
+	}
+
+	if (!bAllReady)
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Benchmark connections did not finish their handshakes within %d frames"), Settings.MaxHandshakeFrames);
+		TearDown();
+		return Result;
+	}
+
+	// Every connection on both sides sends the mix
+	TArray<UNetConnection*> Connections;
+	for (int32 DriverIdx = 1; DriverIdx < Drivers.Num(); DriverIdx++)
+	{
+		Connections.Add(Drivers[DriverIdx]->ServerConnection);
+	}
+	for (UNetConnection* ClientConnection : ServerDriver->ClientConnections)
+	{
+		Connections.Add(ClientConnection);
+	}
+
+	for (int32 Index = 0; Index < Connections.Num(); Index++)
+	{
+		USteamCoreSocketsBenchmarkConnection* Connection = Cast<USteamCoreSocketsBenchmarkConnection>(Connections[Index]);
+		if (Connection == nullptr)
+		{
+			UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Benchmark drivers did not create benchmark connections"));
+			TearDown();
+			return Result;
+		}
+
+		FSteamCoreSocketsBenchmarkPeer& Peer = Peers.AddDefaulted_GetRef();
+		Peer.Connection = Connection;
+		Peer.Connection->m_bCountReceivedPackets = true;
+		const int32 ReservedBits = Connection->Handler.IsValid() ? Connection->Handler->GetTotalReservedPacketBits() : 0;
+		Peer.MaxPayload = FMath::Max(Connection->MaxPacket - FMath::DivideAndRoundUp(ReservedBits, 8), 1);
+
+		// Spread sends over the second instead of having every connection burst on the same frame
+		Peer.Owed.Init(static_cast<double>(Index) / Connections.Num(), NumTraffic);
+	}
+
+	FSteamCoreSocketsLoopbackSettings TransportSettings = Settings.Transport;
+	TransportSettings.bManualClock = true;
+	Transport->SetSettings(TransportSettings);
+
+	// What Steam accepted, summed over every socket's lane stats
+	auto GetSentTotals = [&Subsystem](int64& OutPackets, int64& OutBytes)
+	{
+		OutPackets = 0;
+		OutBytes = 0;
+		for (const TPair<SteamCoreSocketHandles, FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation>& Pair : Subsystem.m_SocketInformationMap)
+		{
+			if (const FSteamCoreSocket* Socket = Pair.Value.m_Socket)
+			{
+				for (int32 LaneIdx = 0; LaneIdx < (int32)ESteamCoreSocketsTrafficClass::Count; LaneIdx++)
+				{
+					OutPackets += Socket->m_LanePacketsSent[LaneIdx];
+					OutBytes += Socket->m_LaneBytesSent[LaneIdx];
+				}
+			}
+		}
+	};
+
+	int32 MaxPacketSize = 1;
+	for (const FSteamCoreSocketsBenchmarkTraffic& Item : Settings.Traffic)
+	{
+		MaxPacketSize = FMath::Max(MaxPacketSize, Item.PacketSize);
+	}
+
+	TArray<uint8> Payload;
+	Payload.SetNumZeroed(MaxPacketSize);
+
+	TArray<double> DispatchMs;
+	TArray<double> FlushMs;
+	DispatchMs.Reserve(Result.NumFrames);
+	FlushMs.Reserve(Result.NumFrames);
+
+	int64 AllocationsAtStart = 0;
+	int64 PacketsSentAtStart = 0;
+	int64 BytesSentAtStart = 0;
+	uint64 WorkCycles = 0;
+
+	const int32 TotalFrames = FMath::Max(Settings.WarmupFrames, 0) + Result.NumFrames;
+	for (int32 Frame = 0; Frame < TotalFrames; Frame++)
+	{
+		const bool bMeasured = Frame >= TotalFrames - Result.NumFrames;
+		if (bMeasured && DispatchMs.Num() == 0)
+		{
+			AllocationsAtStart = GetNumMessageHeapAllocations();
+			GetSentTotals(PacketsSentAtStart, BytesSentAtStart);
+			for (FSteamCoreSocketsBenchmarkPeer& Peer : Peers)
+			{
+				Peer.Connection->m_PacketsReceived = 0;
+				Peer.Connection->m_BytesReceived = 0;
+			}
+		}
+
+		// Flush: every connection sends its packets through LowLevelSend, then each driver hands its batch to the transport
+		const uint64 FlushStart = FPlatformTime::Cycles64();
+		for (FSteamCoreSocketsBenchmarkPeer& Peer : Peers)
+		{
+			for (int32 TrafficIndex = 0; TrafficIndex < NumTraffic; TrafficIndex++)
+			{
+				const FSteamCoreSocketsBenchmarkTraffic& Item = Settings.Traffic[TrafficIndex];
+				Peer.Owed[TrafficIndex] += Item.PacketsPerSecond * FrameSeconds;
+				const int32 Count = FMath::FloorToInt(Peer.Owed[TrafficIndex]);
+				Peer.Owed[TrafficIndex] -= Count;
+
+				const int32 Size = FMath::Min(Item.PacketSize, Peer.MaxPayload);
+				for (int32 Packet = 0; Packet < Count; Packet++)
+				{
+					FOutPacketTraits Traits;
+					Peer.Connection->LowLevelSend(Payload.GetData(), Size * 8, Traits);
+				}
+			}
+		}
+
+		for (TStrongObjectPtr<USteamCoreSocketsNetDriver>& Driver : Drivers)
+		{
+			Driver->FlushOutgoingMessages();
+		}
+		const uint64 FlushCycles = FPlatformTime::Cycles64() - FlushStart;
+
+		Transport->AdvanceTime(FrameSeconds);
+
+		// Dispatch: each driver receives its batches and routes them to the connections through DispatchMessages
+		const uint64 DispatchStart = FPlatformTime::Cycles64();
+		for (TStrongObjectPtr<USteamCoreSocketsNetDriver>& Driver : Drivers)
+		{
+			Driver->TickDispatch(FrameSeconds);
+		}
+		const uint64 DispatchCycles = FPlatformTime::Cycles64() - DispatchStart;
+
+		if (bMeasured)
+		{
+			WorkCycles += FlushCycles + DispatchCycles;
+			FlushMs.Add(FPlatformTime::ToMilliseconds64(FlushCycles));
+			DispatchMs.Add(FPlatformTime::ToMilliseconds64(DispatchCycles));
+		}
+	}
+
+	GetSentTotals(Result.PacketsSent, Result.BytesSent);
+	Result.PacketsSent -= PacketsSentAtStart;
+	Result.BytesSent -= BytesSentAtStart;
+	for (const FSteamCoreSocketsBenchmarkPeer& Peer : Peers)
+	{
+		Result.PacketsReceived += Peer.Connection->m_PacketsReceived;
+		Result.BytesReceived += Peer.Connection->m_BytesReceived;
+	}
+
+	// The counters are process wide, so traffic from real sockets during the run shows up here as well
+	const int64 Allocations = GetNumMessageHeapAllocations() - AllocationsAtStart;
+
+	TearDown();
+
+	FlushMs.Sort();
+	DispatchMs.Sort();
+	Result.bCompleted = true;
+	Result.WorkSeconds = FPlatformTime::ToSeconds64(WorkCycles);
+	Result.PacketsPerSecond = (Result.WorkSeconds > 0.0) ? Result.PacketsSent / Result.WorkSeconds : 0.0;
+	Result.BytesPerSecond = (Result.WorkSeconds > 0.0) ? Result.BytesSent / Result.WorkSeconds : 0.0;
+	Result.DispatchP50Ms = GetPercentile(DispatchMs, 0.5f);
+	Result.DispatchP99Ms = GetPercentile(DispatchMs, 0.99f);
+	Result.FlushP50Ms = GetPercentile(FlushMs, 0.5f);
+	Result.FlushP99Ms = GetPercentile(FlushMs, 0.99f);
+	Result.AllocationsPerPacket = (Result.PacketsSent > 0) ? static_cast<double>(Allocations) / Result.PacketsSent : 0.0;
+	return Result;
+}
+#endif
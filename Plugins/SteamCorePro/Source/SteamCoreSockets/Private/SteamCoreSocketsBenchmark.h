@@ -0,0 +1,101 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamCoreSocketsLoopbackTransport.h"
+
+#if WITH_STEAMCORE
+class FSteamCoreSocketsSubsystem;
+
+/** One kind of packet in the benchmark mix, sent by every client to the server and by the server to every client */
+struct FSteamCoreSocketsBenchmarkTraffic
+{
+	/** Payload handed to LowLevelSend, clamped to what fits in one packet of the connection */
+	int32 PacketSize = 64;
+	float PacketsPerSecond = 30.0f;
+};
+
+struct FSteamCoreSocketsBenchmarkSettings
+{
+	FSteamCoreSocketsBenchmarkSettings();
+
+	int32 NumClients = 16;
+
+	/** Frames measured after the warmup */
+	int32 NumFrames = 600;
+
+	/** Frames run before measuring so pools and containers reach their steady size */
+	int32 WarmupFrames = 60;
+
+	/** Simulated frame length, the transport clock advances by this much per frame */
+	float FrameTimeMs = 1000.0f / 60.0f;
+
+	/** ReceiveBatchSize of every net driver in the run */
+	int32 ReceiveBatchSize = 128;
+
+	/** Frames allowed for the connections and PacketHandler handshakes before the run gives up */
+	int32 MaxHandshakeFrames = 300;
+
+	/** Link conditions of the loopback transport once the handshakes are done, the clock is always manual */
+	FSteamCoreSocketsLoopbackSettings Transport;
+
+	TArray<FSteamCoreSocketsBenchmarkTraffic> Traffic;
+
+	/** Parses "Size:Rate" entries separated by commas, returns false if any entry is malformed */
+	bool ParseTrafficMix(const FString& Mix);
+};
+
+struct FSteamCoreSocketsBenchmarkResult
+{
+	/** False when the drivers could not be set up or connected, nothing was measured */
+	bool bCompleted = false;
+
+	int32 NumClients = 0;
+	int32 NumFrames = 0;
+
+	/** What Steam accepted according to the sockets' lane stats, so bytes include PacketHandler bits */
+	int64 PacketsSent = 0;
+	int64 BytesSent = 0;
+
+	/** What reached the connections through DispatchMessages */
+	int64 PacketsReceived = 0;
+	int64 BytesReceived = 0;
+
+	/** Wall clock time spent sending and dispatching over the measured frames */
+	double WorkSeconds = 0.0;
+
+	double PacketsPerSecond = 0.0;
+	double BytesPerSecond = 0.0;
+
+	/** Time per frame spent in TickDispatch of the server and client drivers */
+	double DispatchP50Ms = 0.0;
+	double DispatchP99Ms = 0.0;
+
+	/** Time per frame spent in LowLevelSend of every connection and FlushOutgoingMessages of every driver */
+	double FlushP50Ms = 0.0;
+	double FlushP99Ms = 0.0;
+
+	/** Heap allocations made by the message pools per packet sent */
+	double AllocationsPerPacket = 0.0;
+
+	FString ToString() const;
+	FString ToJson() const;
+};
+
+/**
+* Soak and throughput benchmark for the net driver path.
+* Installs a loopback transport with a manual clock on the subsystem, then runs a listening USteamCoreSocketsNetDriver
+* and one connecting driver per client through the Steam connection and PacketHandler handshakes. The configured mix is
+* sent through each connection's LowLevelSend, flushed with FlushOutgoingMessages and received with TickDispatch.
+* Only runs while the subsystem has no sockets open, its previous transport is restored afterwards.
+*/
+class FSteamCoreSocketsBenchmark
+{
+public:
+	static FSteamCoreSocketsBenchmarkResult Run(FSteamCoreSocketsSubsystem& Subsystem, const FSteamCoreSocketsBenchmarkSettings& Settings);
+};
+#endif
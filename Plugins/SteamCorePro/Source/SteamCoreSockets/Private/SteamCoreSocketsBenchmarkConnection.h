@@ -0,0 +1,37 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamCoreSocketsNetConnection.h"
+#include "SteamCoreSocketsBenchmarkConnection.generated.h"
+
+/**
+* Connection class the benchmark's net drivers create. Everything up to the engine's packet parsing is the regular
+* USteamCoreSocketsNetConnection path, the benchmark payload is not an engine packet so it is counted once the handshake is done.
+*/
+UCLASS(transient)
+class USteamCoreSocketsBenchmarkConnection : public USteamCoreSocketsNetConnection
+{
+	GENERATED_BODY()
+
+public:
+	USteamCoreSocketsBenchmarkConnection() :
+		m_bCountReceivedPackets(false),
+		m_PacketsReceived(0),
+		m_BytesReceived(0)
+	{
+	}
+
+	//~ Begin NetConnection Interface
+	virtual void ReceivedRawPacket(void* Data, int32 Count) override;
+	//~ End NetConnection Interface
+
+	/** Set by the benchmark once both sides finished the handshake */
+	bool m_bCountReceivedPackets;
+	int64 m_PacketsReceived;
+	int64 m_BytesReceived;
+};
@@ -0,0 +1,166 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#include "SteamCoreSocketsIOThread.h"
+#include "SteamCoreSocketsSubsystem.h"
+#include "SteamCoreSocketsTransport.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+#if WITH_STEAMCORE
+FSteamCoreSocketsIOThread::FSteamCoreSocketsIOThread(HSteamNetPollGroup InPollGroup, HSteamNetConnection InConnection, int32 InBatchSize, int32 InWaitTimeMs)
+	: m_PollGroup(InPollGroup),
+	  m_Connection(InConnection),
+	  m_BatchSize(FMath::Clamp(InBatchSize, 1, 256)),
+	  m_WaitTimeMs(FMath::Max(InWaitTimeMs, 0)),
+	  m_WakeEvent(FPlatformProcess::GetSynchEventFromPool(false)),
+	  m_Thread(nullptr),
+	  m_bStopping(false)
+{
+	m_ReceiveBuffer.SetNumZeroed(m_BatchSize);
+}
+
+FSteamCoreSocketsIOThread::~FSteamCoreSocketsIOThread()
+{
+	StopAndFlush();
+
+	SteamNetworkingMessage_t* Message = nullptr;
+	while (m_InboundMessages.Dequeue(Message))
+	{
+		Message->Release();
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(m_WakeEvent);
+	m_WakeEvent = nullptr;
+}
+
+void FSteamCoreSocketsIOThread::StopAndFlush()
+{
+	if (m_Thread != nullptr)
+	{
+		m_Thread->Kill(true);
+		delete m_Thread;
+		m_Thread = nullptr;
+	}
+
+	// The thread is gone, hand anything still queued to Steam and free what was never dispatched
+	if (ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport())
+	{
+		SendQueued(SocketInterface);
+	}
+	else
+	{
+		TArray<SteamNetworkingMessage_t*> Batch;
+		while (m_OutboundBatches.Dequeue(Batch))
+		{
+			for (SteamNetworkingMessage_t* Message : Batch)
+			{
+				Message->Release();
+			}
+		}
+	}
+}
+
+bool FSteamCoreSocketsIOThread::Start(const FString& ThreadName)
+{
+	m_Thread = FRunnableThread::Create(this, *ThreadName, 0, TPri_AboveNormal);
+	return m_Thread != nullptr;
+}
+
+uint32 FSteamCoreSocketsIOThread::Run()
+{
+	while (!m_bStopping.load(std::memory_order_relaxed))
+	{
+		ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
+		if (SocketInterface == nullptr)
+		{
+			m_WakeEvent->Wait(m_WaitTimeMs);
+			continue;
+		}
+
+		SendQueued(SocketInterface);
+
+		// Keep pulling while full batches come back, then sleep until woken by a send or the wait expires
+		if (ReceiveAvailable(SocketInterface) < m_BatchSize)
+		{
+			m_WakeEvent->Wait(m_WaitTimeMs);
+		}
+	}
+
+	return 0;
+}
+
+void FSteamCoreSocketsIOThread::Stop()
+{
+	m_bStopping.store(true, std::memory_order_relaxed);
+	m_WakeEvent->Trigger();
+}
+
+void FSteamCoreSocketsIOThread::QueueSend(TArray<SteamNetworkingMessage_t*>&& Messages)
+{
+	if (Messages.Num() > 0)
+	{
+		m_OutboundBatches.Enqueue(MoveTemp(Messages));
+		m_WakeEvent->Trigger();
+	}
+}
+
+void FSteamCoreSocketsIOThread::SendQueued(ISteamCoreSocketsTransport* SocketInterface)
+{
+	TArray<SteamNetworkingMessage_t*> Batch;
+	while (m_OutboundBatches.Dequeue(Batch))
+	{
+		m_SendResults.Reset();
+		m_SendResults.AddUninitialized(Batch.Num());
+
+		// Steam releases the messages, keep what the lane stats need before sending
+		TArray<FSteamCoreSocketsSentMessage> Sent;
+		Sent.Reserve(Batch.Num());
+		for (const SteamNetworkingMessage_t* Message : Batch)
+		{
+			Sent.Add({ Message->m_conn, (uint16)Message->m_idxLane, Message->m_cbSize });
+		}
+
+		// Steam takes ownership of every message whether or not it could be sent
+		SocketInterface->SendMessages(Batch.Num(), Batch.GetData(), m_SendResults.GetData());
+
+		int32 NumSent = 0;
+		for (int32 MessageIdx = 0; MessageIdx < m_SendResults.Num(); ++MessageIdx)
+		{
+			if (m_SendResults[MessageIdx] >= 0)
+			{
+				Sent[NumSent++] = Sent[MessageIdx];
+			}
+		}
+
+		const int32 NumFailed = Batch.Num() - NumSent;
+		if (NumSent > 0)
+		{
+			Sent.SetNum(NumSent, EAllowShrinking::No);
+			m_SentBatches.Enqueue(MoveTemp(Sent));
+		}
+		UE_CLOG(NumFailed > 0, LogNet, Warning, TEXT("SteamCoreSockets: Network thread could not send %d of %d messages"), NumFailed, Batch.Num());
+	}
+}
+
+int32 FSteamCoreSocketsIOThread::ReceiveAvailable(ISteamCoreSocketsTransport* SocketInterface)
+{
+	const int32 Received = (m_PollGroup != k_HSteamNetPollGroup_Invalid) ? SocketInterface->ReceiveMessagesOnPollGroup(m_PollGroup, m_ReceiveBuffer.GetData(), m_BatchSize) : SocketInterface->ReceiveMessagesOnConnection(m_Connection, m_ReceiveBuffer.GetData(), m_BatchSize);
+	if (Received < 0)
+	{
+		// The handle is gone, the driver stops the thread once it processes the disconnect
+		return 0;
+	}
+
+	for (int32 MessageIdx = 0; MessageIdx < Received; ++MessageIdx)
+	{
+		m_InboundMessages.Enqueue(m_ReceiveBuffer[MessageIdx]);
+		m_ReceiveBuffer[MessageIdx] = nullptr;
+	}
+
+	return Received;
+}
+#endif
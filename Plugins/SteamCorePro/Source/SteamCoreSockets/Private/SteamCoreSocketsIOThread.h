@@ -0,0 +1,72 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "SteamCoreSocketsPrivate.h"
+#include "SteamCoreSocketsTypes.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+class ISteamCoreSocketsTransport;
+
+#if WITH_STEAMCORE
+/**
+* Optional network thread owned by a USteamCoreSocketsNetDriver.
+* Receives from the driver's poll group (listen sockets) or connection (clients) and sends the batches flushed by the driver.
+* The thread only talks to the socket transport, all FSteamCoreSocket and connection state stays on the game thread.
+* Each queue has a single producer and a single consumer, the game thread being the other side.
+*/
+class FSteamCoreSocketsIOThread : public FRunnable
+{
+public:
+	FSteamCoreSocketsIOThread(HSteamNetPollGroup InPollGroup, HSteamNetConnection InConnection, int32 InBatchSize, int32 InWaitTimeMs);
+	virtual ~FSteamCoreSocketsIOThread() override;
+
+	bool Start(const FString& ThreadName);
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable Interface
+
+	/** Game thread: pops the next received message, the caller must release it */
+	bool DequeueReceived(SteamNetworkingMessage_t*& OutMessage) { return m_InboundMessages.Dequeue(OutMessage); }
+
+	/** Game thread: takes ownership of a frame of outgoing messages and wakes the thread to send them */
+	void QueueSend(TArray<SteamNetworkingMessage_t*>&& Messages);
+
+	/** Game thread: pops the messages of one sent batch that Steam accepted */
+	bool DequeueSent(TArray<FSteamCoreSocketsSentMessage>& OutSent) { return m_SentBatches.Dequeue(OutSent); }
+
+	/** Game thread: joins the thread and sends what it still had queued, the results stay available through DequeueSent */
+	void StopAndFlush();
+
+private:
+	void SendQueued(ISteamCoreSocketsTransport* SocketInterface);
+	int32 ReceiveAvailable(ISteamCoreSocketsTransport* SocketInterface);
+
+	HSteamNetPollGroup m_PollGroup;
+	HSteamNetConnection m_Connection;
+	int32 m_BatchSize;
+	int32 m_WaitTimeMs;
+
+	TQueue<SteamNetworkingMessage_t*, EQueueMode::Spsc> m_InboundMessages;
+	TQueue<TArray<SteamNetworkingMessage_t*>, EQueueMode::Spsc> m_OutboundBatches;
+	TQueue<TArray<FSteamCoreSocketsSentMessage>, EQueueMode::Spsc> m_SentBatches;
+
+	// Only touched by the network thread
+	TArray<SteamNetworkingMessage_t*> m_ReceiveBuffer;
+	TArray<int64> m_SendResults;
+
+	FEvent* m_WakeEvent;
+	FRunnableThread* m_Thread;
+	std::atomic<bool> m_bStopping;
+};
+#endif
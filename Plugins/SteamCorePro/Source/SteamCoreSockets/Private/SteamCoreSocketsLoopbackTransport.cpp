@@ -0,0 +1,787 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#include "SteamCoreSocketsLoopbackTransport.h"
+#include "SteamCoreSocketsSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Containers/LockFreeList.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+#if WITH_STEAMCORE
+static TLockFreePointerListUnordered<SteamNetworkingMessage_t, PLATFORM_CACHE_LINE_SIZE> GSteamCoreLoopbackFreeMessages;
+static FThreadSafeCounter64 GSteamCoreLoopbackHeapAllocations;
+
+// Loopback peers are given addresses and ids no real peer would have
+static constexpr uint32 LoopbackIPv4 = 0x7f000001;
+static constexpr uint16 LoopbackFirstClientPort = 49152;
+static constexpr uint64 LoopbackSteamIDBase = 76561197960265728ull;
+
+FSteamCoreSocketsLoopbackTransport::FSteamCoreSocketsLoopbackTransport(const FSteamCoreSocketsLoopbackSettings& InSettings)
+	: m_Settings(InSettings),
+	  m_Random(InSettings.Seed),
+	  m_ManualTime(0.0),
+	  m_NextHandle(1),
+	  m_NextClientPort(LoopbackFirstClientPort)
+{
+}
+
+FSteamCoreSocketsLoopbackTransport::~FSteamCoreSocketsLoopbackTransport()
+{
+	FScopeLock Lock(&m_Lock);
+
+	for (TPair<HSteamNetConnection, FConnection>& Pair : m_Connections)
+	{
+		for (const FInFlightMessage& Item : Pair.Value.InFlight)
+		{
+			Item.Message->Release();
+		}
+		for (SteamNetworkingMessage_t* Message : Pair.Value.Inbox)
+		{
+			Message->Release();
+		}
+	}
+
+	for (TPair<HSteamNetPollGroup, TArray<SteamNetworkingMessage_t*>>& Pair : m_PollGroups)
+	{
+		for (SteamNetworkingMessage_t* Message : Pair.Value)
+		{
+			Message->Release();
+		}
+	}
+
+	m_Connections.Empty();
+	m_Listeners.Empty();
+	m_PollGroups.Empty();
+	m_PendingEvents.Empty();
+}
+
+double FSteamCoreSocketsLoopbackTransport::GetTime() const
+{
+	return m_Settings.bManualClock ? m_ManualTime : FPlatformTime::Seconds();
+}
+
+void FSteamCoreSocketsLoopbackTransport::SetSettings(const FSteamCoreSocketsLoopbackSettings& InSettings)
+{
+	FScopeLock Lock(&m_Lock);
+	m_Settings = InSettings;
+	m_Random.Initialize(InSettings.Seed);
+}
+
+FSteamCoreSocketsLoopbackSettings FSteamCoreSocketsLoopbackTransport::GetSettings() const
+{
+	FScopeLock Lock(&m_Lock);
+	return m_Settings;
+}
+
+void FSteamCoreSocketsLoopbackTransport::AdvanceTime(double Seconds)
+{
+	FScopeLock Lock(&m_Lock);
+	if (m_Settings.bManualClock)
+	{
+		m_ManualTime += FMath::Max(Seconds, 0.0);
+	}
+}
+
+HSteamListenSocket FSteamCoreSocketsLoopbackTransport::CreateListenSocketIP(const SteamNetworkingIPAddr& LocalAddress, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	FScopeLock Lock(&m_Lock);
+	for (const TPair<HSteamListenSocket, FListener>& Pair : m_Listeners)
+	{
+		if (!Pair.Value.bIsP2P && Pair.Value.Port == LocalAddress.m_port)
+		{
+			return k_HSteamListenSocket_Invalid;
+		}
+	}
+
+	FListener Listener;
+	Listener.Handle = NextHandle();
+	Listener.bIsP2P = false;
+	Listener.Port = LocalAddress.m_port;
+	m_Listeners.Add(Listener.Handle, Listener);
+	return Listener.Handle;
+}
+
+HSteamListenSocket FSteamCoreSocketsLoopbackTransport::CreateListenSocketP2P(int32 LocalVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	FScopeLock Lock(&m_Lock);
+	for (const TPair<HSteamListenSocket, FListener>& Pair : m_Listeners)
+	{
+		if (Pair.Value.bIsP2P && Pair.Value.Port == LocalVirtualPort)
+		{
+			return k_HSteamListenSocket_Invalid;
+		}
+	}
+
+	FListener Listener;
+	Listener.Handle = NextHandle();
+	Listener.bIsP2P = true;
+	Listener.Port = LocalVirtualPort;
+	m_Listeners.Add(Listener.Handle, Listener);
+	return Listener.Handle;
+}
+
+HSteamNetConnection FSteamCoreSocketsLoopbackTransport::ConnectByIPAddress(const SteamNetworkingIPAddr& Address, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	FScopeLock Lock(&m_Lock);
+	const FListener* Listener = nullptr;
+	for (const TPair<HSteamListenSocket, FListener>& Pair : m_Listeners)
+	{
+		if (!Pair.Value.bIsP2P && Pair.Value.Port == Address.m_port)
+		{
+			Listener = &Pair.Value;
+			break;
+		}
+	}
+
+	SteamNetworkingIdentity RemoteIdentity;
+	RemoteIdentity.SetIPAddr(Address);
+	return CreateConnectionPair(Listener, RemoteIdentity, Address);
+}
+
+HSteamNetConnection FSteamCoreSocketsLoopbackTransport::ConnectP2P(const SteamNetworkingIdentity& RemoteIdentity, int32 RemoteVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	FScopeLock Lock(&m_Lock);
+	const FListener* Listener = nullptr;
+	for (const TPair<HSteamListenSocket, FListener>& Pair : m_Listeners)
+	{
+		if (Pair.Value.bIsP2P && Pair.Value.Port == RemoteVirtualPort)
+		{
+			Listener = &Pair.Value;
+			break;
+		}
+	}
+
+	SteamNetworkingIPAddr RemoteAddr;
+	RemoteAddr.Clear();
+	return CreateConnectionPair(Listener, RemoteIdentity, RemoteAddr);
+}
+
+HSteamNetConnection FSteamCoreSocketsLoopbackTransport::CreateConnectionPair(const FListener* Listener, const SteamNetworkingIdentity& RemoteIdentity, const SteamNetworkingIPAddr& RemoteAddr)
+{
+	const double Now = GetTime();
+
+	FConnection Client;
+	Client.Handle = NextHandle();
+	Client.RemoteIdentity = RemoteIdentity;
+	Client.RemoteAddr = RemoteAddr;
+	Client.State = k_ESteamNetworkingConnectionState_Connecting;
+	Client.RateWindowStart = Now;
+	const HSteamNetConnection ClientHandle = Client.Handle;
+
+	if (Listener == nullptr)
+	{
+		// Nobody listens on that port, fail the way an unreachable host would
+		FConnection& AddedClient = m_Connections.Add(ClientHandle, MoveTemp(Client));
+		SetState(AddedClient, k_ESteamNetworkingConnectionState_ProblemDetectedLocally, k_ESteamNetConnectionEnd_Misc_Timeout);
+		return ClientHandle;
+	}
+
+	FConnection Server;
+	Server.Handle = NextHandle();
+	Server.ListenSocket = Listener->Handle;
+	Server.RateWindowStart = Now;
+	Server.RemoteIdentity.Clear();
+	Server.RemoteAddr.Clear();
+	if (Listener->bIsP2P)
+	{
+		Server.RemoteIdentity.SetSteamID64(LoopbackSteamIDBase + ClientHandle);
+	}
+	else
+	{
+		Server.RemoteAddr.SetIPv4(LoopbackIPv4, m_NextClientPort);
+		Server.RemoteIdentity.SetIPAddr(Server.RemoteAddr);
+		m_NextClientPort = (m_NextClientPort == MAX_uint16) ? LoopbackFirstClientPort : m_NextClientPort + 1;
+	}
+
+	Server.Peer = ClientHandle;
+	Client.Peer = Server.Handle;
+	const HSteamNetConnection ServerHandle = Server.Handle;
+
+	m_Connections.Add(ClientHandle, MoveTemp(Client));
+	FConnection& AddedServer = m_Connections.Add(ServerHandle, MoveTemp(Server));
+
+	// The listener hears about the connection like it would from Steam, the client waits for the accept
+	SetState(AddedServer, k_ESteamNetworkingConnectionState_Connecting);
+	return ClientHandle;
+}
+
+EResult FSteamCoreSocketsLoopbackTransport::AcceptConnection(HSteamNetConnection Connection)
+{
+	FScopeLock Lock(&m_Lock);
+	FConnection* Server = FindConnection(Connection);
+	if (Server == nullptr || Server->ListenSocket == k_HSteamListenSocket_Invalid)
+	{
+		return k_EResultInvalidParam;
+	}
+
+	if (Server->State != k_ESteamNetworkingConnectionState_Connecting)
+	{
+		return k_EResultInvalidState;
+	}
+
+	FConnection* Client = FindConnection(Server->Peer);
+	if (Client == nullptr || Client->State != k_ESteamNetworkingConnectionState_Connecting)
+	{
+		return k_EResultNoConnection;
+	}
+
+	SetState(*Server, k_ESteamNetworkingConnectionState_Connected);
+	SetState(*Client, k_ESteamNetworkingConnectionState_Connected);
+	return k_EResultOK;
+}
+
+bool FSteamCoreSocketsLoopbackTransport::CloseConnection(HSteamNetConnection Connection, int32 Reason, const char* Debug, bool bEnableLinger)
+{
+	FScopeLock Lock(&m_Lock);
+	FConnection* Closed = FindConnection(Connection);
+	if (Closed == nullptr)
+	{
+		return false;
+	}
+
+	CloseConnectionLocked(*Closed, Reason, true);
+	m_Connections.Remove(Connection);
+	return true;
+}
+
+bool FSteamCoreSocketsLoopbackTransport::CloseListenSocket(HSteamListenSocket ListenSocket)
+{
+	FScopeLock Lock(&m_Lock);
+	if (m_Listeners.Remove(ListenSocket) == 0)
+	{
+		return false;
+	}
+
+	// Accepted connections go down with the listener, their peers see the close
+	TArray<HSteamNetConnection, TInlineAllocator<16>> Accepted;
+	for (const TPair<HSteamNetConnection, FConnection>& Pair : m_Connections)
+	{
+		if (Pair.Value.ListenSocket == ListenSocket)
+		{
+			Accepted.Add(Pair.Key);
+		}
+	}
+
+	for (const HSteamNetConnection Handle : Accepted)
+	{
+		CloseConnectionLocked(m_Connections[Handle], k_ESteamNetConnectionEnd_App_Generic, true);
+		m_Connections.Remove(Handle);
+	}
+	return true;
+}
+
+void FSteamCoreSocketsLoopbackTransport::CloseConnectionLocked(FConnection& Connection, int32 Reason, bool bNotifyPeer)
+{
+	if (FConnection* Peer = FindConnection(Connection.Peer))
+	{
+		Peer->Peer = k_HSteamNetConnection_Invalid;
+		if (bNotifyPeer && (Peer->State == k_ESteamNetworkingConnectionState_Connecting || Peer->State == k_ESteamNetworkingConnectionState_Connected))
+		{
+			SetState(*Peer, k_ESteamNetworkingConnectionState_ClosedByPeer, Reason);
+		}
+	}
+
+	for (const FInFlightMessage& Item : Connection.InFlight)
+	{
+		Item.Message->Release();
+	}
+	Connection.InFlight.Empty();
+
+	for (SteamNetworkingMessage_t* Message : Connection.Inbox)
+	{
+		Message->Release();
+	}
+	Connection.Inbox.Empty();
+
+	if (TArray<SteamNetworkingMessage_t*>* PollGroupMessages = m_PollGroups.Find(Connection.PollGroup))
+	{
+		const HSteamNetConnection Handle = Connection.Handle;
+		PollGroupMessages->RemoveAll([Handle](SteamNetworkingMessage_t* Message)
+		{
+			if (Message->m_conn == Handle)
+			{
+				Message->Release();
+				return true;
+			}
+			return false;
+		});
+	}
+}
+
+HSteamNetPollGroup FSteamCoreSocketsLoopbackTransport::CreatePollGroup()
+{
+	FScopeLock Lock(&m_Lock);
+	const HSteamNetPollGroup PollGroup = NextHandle();
+	m_PollGroups.Add(PollGroup);
+	return PollGroup;
+}
+
+bool FSteamCoreSocketsLoopbackTransport::DestroyPollGroup(HSteamNetPollGroup PollGroup)
+{
+	FScopeLock Lock(&m_Lock);
+	TArray<SteamNetworkingMessage_t*>* PollGroupMessages = m_PollGroups.Find(PollGroup);
+	if (PollGroupMessages == nullptr)
+	{
+		return false;
+	}
+
+	for (SteamNetworkingMessage_t* Message : *PollGroupMessages)
+	{
+		Message->Release();
+	}
+	m_PollGroups.Remove(PollGroup);
+
+	for (TPair<HSteamNetConnection, FConnection>& Pair : m_Connections)
+	{
+		if (Pair.Value.PollGroup == PollGroup)
+		{
+			Pair.Value.PollGroup = k_HSteamNetPollGroup_Invalid;
+		}
+	}
+	return true;
+}
+
+bool FSteamCoreSocketsLoopbackTransport::SetConnectionPollGroup(HSteamNetConnection Connection, HSteamNetPollGroup PollGroup)
+{
+	FScopeLock Lock(&m_Lock);
+
+	// Listen sockets never receive, connections they accept are assigned to the group one by one
+	if (m_Listeners.Contains(Connection))
+	{
+		return true;
+	}
+
+	FConnection* Assigned = FindConnection(Connection);
+	TArray<SteamNetworkingMessage_t*>* PollGroupMessages = m_PollGroups.Find(PollGroup);
+	if (Assigned == nullptr || (PollGroup != k_HSteamNetPollGroup_Invalid && PollGroupMessages == nullptr))
+	{
+		return false;
+	}
+
+	Assigned->PollGroup = PollGroup;
+	if (PollGroupMessages != nullptr)
+	{
+		PollGroupMessages->Append(Assigned->Inbox);
+		Assigned->Inbox.Reset();
+	}
+	return true;
+}
+
+EResult FSteamCoreSocketsLoopbackTransport::SendMessageToConnection(HSteamNetConnection Connection, const void* Data, uint32 Size, int32 SendFlags, int64* OutMessageNumber)
+{
+	if (Size > (uint32)k_cbMaxSteamNetworkingSocketsMessageSizeSend || (Data == nullptr && Size > 0))
+	{
+		return k_EResultInvalidParam;
+	}
+
+	SteamNetworkingMessage_t* Message = AllocateMessage(Size);
+	if (Size > 0)
+	{
+		FMemory::Memcpy(Message->m_pData, Data, Size);
+	}
+	Message->m_conn = Connection;
+	Message->m_nFlags = SendFlags;
+
+	FScopeLock Lock(&m_Lock);
+	FConnection* Sender = FindConnection(Connection);
+	if (Sender == nullptr)
+	{
+		Message->Release();
+		return k_EResultInvalidParam;
+	}
+
+	const int64 Result = SendLocked(*Sender, Message);
+	if (Result < 0)
+	{
+		return static_cast<EResult>(-Result);
+	}
+
+	if (OutMessageNumber != nullptr)
+	{
+		*OutMessageNumber = Result;
+	}
+	return k_EResultOK;
+}
+
+void FSteamCoreSocketsLoopbackTransport::SendMessages(int32 NumMessages, SteamNetworkingMessage_t* const* Messages, int64* OutMessageNumberOrResult)
+{
+	FScopeLock Lock(&m_Lock);
+	for (int32 MessageIdx = 0; MessageIdx < NumMessages; ++MessageIdx)
+	{
+		SteamNetworkingMessage_t* Message = Messages[MessageIdx];
+		FConnection* Sender = FindConnection(Message->m_conn);
+
+		int64 Result = -k_EResultInvalidParam;
+		if (Sender != nullptr)
+		{
+			Result = SendLocked(*Sender, Message);
+		}
+		else
+		{
+			Message->Release();
+		}
+
+		if (OutMessageNumberOrResult != nullptr)
+		{
+			OutMessageNumberOrResult[MessageIdx] = Result;
+		}
+	}
+}
+
+int64 FSteamCoreSocketsLoopbackTransport::SendLocked(FConnection& Sender, SteamNetworkingMessage_t* Message)
+{
+	if (Sender.State != k_ESteamNetworkingConnectionState_Connected)
+	{
+		Message->Release();
+		return -k_EResultInvalidState;
+	}
+
+	FConnection* Receiver = FindConnection(Sender.Peer);
+	if (Receiver == nullptr)
+	{
+		Message->Release();
+		return -k_EResultNoConnection;
+	}
+
+	if (Message->m_cbSize < 0 || Message->m_cbSize > k_cbMaxSteamNetworkingSocketsMessageSizeSend)
+	{
+		Message->Release();
+		return -k_EResultInvalidParam;
+	}
+
+	const double Now = GetTime();
+	UpdateRatesLocked(Sender, Now);
+
+	const int64 MessageNumber = Sender.NextMessageNumber++;
+	const bool bIsReliable = (Message->m_nFlags & k_nSteamNetworkingSend_Reliable) != 0;
+	Sender.BytesOut += Message->m_cbSize;
+	Sender.PacketsOut++;
+	Sender.RateWindowBytesOut += Message->m_cbSize;
+	Sender.RateWindowPacketsOut++;
+
+	if (!bIsReliable && m_Settings.LossPercent > 0.0f && m_Random.FRand() * 100.0f < m_Settings.LossPercent)
+	{
+		// Dropped on the wire, the sender still sees a successful send
+		Message->Release();
+		return MessageNumber;
+	}
+
+	double DeliverTime = Now + m_Settings.LatencyMs / 1000.0;
+	if (m_Settings.JitterMs > 0.0f)
+	{
+		DeliverTime += m_Random.FRandRange(0.0f, m_Settings.JitterMs) / 1000.0;
+	}
+
+	if (bIsReliable)
+	{
+		DeliverTime = FMath::Max(DeliverTime, Sender.LastReliableDeliverTime);
+		Sender.LastReliableDeliverTime = DeliverTime;
+		Sender.UnackedReliableBytes += Message->m_cbSize;
+	}
+	else if (m_Settings.ReorderPercent > 0.0f && m_Random.FRand() * 100.0f < m_Settings.ReorderPercent)
+	{
+		DeliverTime += m_Settings.ReorderDelayMs / 1000.0;
+	}
+
+	// From here on the message is what the receiver will see
+	Message->m_conn = Receiver->Handle;
+	Message->m_identityPeer = Receiver->RemoteIdentity;
+	Message->m_nConnUserData = 0;
+	Message->m_nMessageNumber = MessageNumber;
+	Message->m_nChannel = 0;
+	Message->m_nFlags = bIsReliable ? k_nSteamNetworkingSend_Reliable : 0;
+
+	FInFlightMessage Item;
+	Item.Message = Message;
+	Item.DeliverTime = DeliverTime;
+
+	// Equal delivery times keep send order
+	const int32 InsertIdx = Algo::UpperBoundBy(Receiver->InFlight, DeliverTime, &FInFlightMessage::DeliverTime);
+	Receiver->InFlight.Insert(Item, InsertIdx);
+	return MessageNumber;
+}
+
+void FSteamCoreSocketsLoopbackTransport::PumpLocked(double Now)
+{
+	for (TPair<HSteamNetConnection, FConnection>& Pair : m_Connections)
+	{
+		FConnection& Connection = Pair.Value;
+
+		int32 NumDue = 0;
+		while (NumDue < Connection.InFlight.Num() && Connection.InFlight[NumDue].DeliverTime <= Now)
+		{
+			++NumDue;
+		}
+
+		if (NumDue == 0)
+		{
+			continue;
+		}
+
+		for (int32 ItemIdx = 0; ItemIdx < NumDue; ++ItemIdx)
+		{
+			DeliverLocked(Connection, Connection.InFlight[ItemIdx].Message);
+		}
+		Connection.InFlight.RemoveAt(0, NumDue);
+	}
+}
+
+void FSteamCoreSocketsLoopbackTransport::DeliverLocked(FConnection& Connection, SteamNetworkingMessage_t* Message)
+{
+	const double Now = GetTime();
+	Message->m_usecTimeReceived = static_cast<SteamNetworkingMicroseconds>(Now * 1000000.0);
+
+	Connection.BytesIn += Message->m_cbSize;
+	Connection.PacketsIn++;
+	Connection.RateWindowBytesIn += Message->m_cbSize;
+	Connection.RateWindowPacketsIn++;
+
+	if ((Message->m_nFlags & k_nSteamNetworkingSend_Reliable) != 0)
+	{
+		// Delivery doubles as the ack
+		if (FConnection* Sender = FindConnection(Connection.Peer))
+		{
+			Sender->UnackedReliableBytes = FMath::Max(Sender->UnackedReliableBytes - Message->m_cbSize, 0);
+		}
+	}
+
+	if (TArray<SteamNetworkingMessage_t*>* PollGroupMessages = m_PollGroups.Find(Connection.PollGroup))
+	{
+		PollGroupMessages->Add(Message);
+	}
+	else
+	{
+		Connection.Inbox.Add(Message);
+	}
+}
+
+void FSteamCoreSocketsLoopbackTransport::UpdateRatesLocked(FConnection& Connection, double Now)
+{
+	const double Elapsed = Now - Connection.RateWindowStart;
+	if (Elapsed < 1.0)
+	{
+		return;
+	}
+
+	Connection.OutBytesPerSec = static_cast<float>(Connection.RateWindowBytesOut / Elapsed);
+	Connection.OutPacketsPerSec = static_cast<float>(Connection.RateWindowPacketsOut / Elapsed);
+	Connection.InBytesPerSec = static_cast<float>(Connection.RateWindowBytesIn / Elapsed);
+	Connection.InPacketsPerSec = static_cast<float>(Connection.RateWindowPacketsIn / Elapsed);
+	Connection.RateWindowBytesOut = 0;
+	Connection.RateWindowPacketsOut = 0;
+	Connection.RateWindowBytesIn = 0;
+	Connection.RateWindowPacketsIn = 0;
+	Connection.RateWindowStart = Now;
+}
+
+int32 FSteamCoreSocketsLoopbackTransport::ReceiveMessagesOnConnection(HSteamNetConnection Connection, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages)
+{
+	FScopeLock Lock(&m_Lock);
+	PumpLocked(GetTime());
+
+	FConnection* Receiver = FindConnection(Connection);
+	if (Receiver == nullptr)
+	{
+		return -1;
+	}
+
+	const int32 NumMessages = FMath::Min(MaxMessages, Receiver->Inbox.Num());
+	if (NumMessages > 0)
+	{
+		FMemory::Memcpy(OutMessages, Receiver->Inbox.GetData(), NumMessages * sizeof(SteamNetworkingMessage_t*));
+		Receiver->Inbox.RemoveAt(0, NumMessages);
+	}
+	return NumMessages;
+}
+
+int32 FSteamCoreSocketsLoopbackTransport::ReceiveMessagesOnPollGroup(HSteamNetPollGroup PollGroup, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages)
+{
+	FScopeLock Lock(&m_Lock);
+	PumpLocked(GetTime());
+
+	TArray<SteamNetworkingMessage_t*>* PollGroupMessages = m_PollGroups.Find(PollGroup);
+	if (PollGroupMessages == nullptr)
+	{
+		return -1;
+	}
+
+	const int32 NumMessages = FMath::Min(MaxMessages, PollGroupMessages->Num());
+	if (NumMessages > 0)
+	{
+		FMemory::Memcpy(OutMessages, PollGroupMessages->GetData(), NumMessages * sizeof(SteamNetworkingMessage_t*));
+		PollGroupMessages->RemoveAt(0, NumMessages);
+	}
+	return NumMessages;
+}
+
+bool FSteamCoreSocketsLoopbackTransport::GetConnectionInfo(HSteamNetConnection Connection, SteamNetConnectionInfo_t* OutInfo)
+{
+	FScopeLock Lock(&m_Lock);
+	const FConnection* Found = FindConnection(Connection);
+	if (Found == nullptr || OutInfo == nullptr)
+	{
+		return false;
+	}
+
+	FillConnectionInfo(*Found, *OutInfo);
+	return true;
+}
+
+EResult FSteamCoreSocketsLoopbackTransport::GetConnectionRealTimeStatus(HSteamNetConnection Connection, SteamNetConnectionRealTimeStatus_t* OutStatus, int32 NumLanes, SteamNetConnectionRealTimeLaneStatus_t* OutLanes)
+{
+	FScopeLock Lock(&m_Lock);
+	const double Now = GetTime();
+	PumpLocked(Now);
+
+	FConnection* Found = FindConnection(Connection);
+	if (Found == nullptr)
+	{
+		return k_EResultNoConnection;
+	}
+
+	if (NumLanes < 0 || NumLanes > Found->NumLanes || (NumLanes > 0 && OutLanes == nullptr))
+	{
+		return k_EResultInvalidParam;
+	}
+
+	UpdateRatesLocked(*Found, Now);
+
+	if (OutStatus != nullptr)
+	{
+		FMemory::Memzero(*OutStatus);
+		OutStatus->m_eState = Found->State;
+		OutStatus->m_nPing = FMath::RoundToInt(2.0f * m_Settings.LatencyMs + m_Settings.JitterMs);
+		OutStatus->m_flConnectionQualityLocal = 1.0f - FMath::Clamp(m_Settings.LossPercent + m_Settings.ReorderPercent, 0.0f, 100.0f) / 100.0f;
+		OutStatus->m_flConnectionQualityRemote = OutStatus->m_flConnectionQualityLocal;
+		OutStatus->m_flOutPacketsPerSec = Found->OutPacketsPerSec;
+		OutStatus->m_flOutBytesPerSec = Found->OutBytesPerSec;
+		OutStatus->m_flInPacketsPerSec = Found->InPacketsPerSec;
+		OutStatus->m_flInBytesPerSec = Found->InBytesPerSec;
+		OutStatus->m_nSendRateBytesPerSecond = m_Settings.SendRateBytesPerSec;
+		OutStatus->m_cbSentUnackedReliable = Found->UnackedReliableBytes;
+	}
+
+	// Messages leave the sender immediately, so nothing is ever pending on a lane
+	for (int32 LaneIdx = 0; LaneIdx < NumLanes; ++LaneIdx)
+	{
+		FMemory::Memzero(OutLanes[LaneIdx]);
+	}
+	return k_EResultOK;
+}
+
+EResult FSteamCoreSocketsLoopbackTransport::ConfigureConnectionLanes(HSteamNetConnection Connection, int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights)
+{
+	FScopeLock Lock(&m_Lock);
+	FConnection* Found = FindConnection(Connection);
+	if (Found == nullptr)
+	{
+		return k_EResultNoConnection;
+	}
+
+	if (NumLanes < 1 || NumLanes > MAX_uint8)
+	{
+		return k_EResultInvalidParam;
+	}
+
+	Found->NumLanes = NumLanes;
+	return k_EResultOK;
+}
+
+void FSteamCoreSocketsLoopbackTransport::SetState(FConnection& Connection, ESteamNetworkingConnectionState NewState, int32 EndReason)
+{
+	SteamNetConnectionStatusChangedCallback_t& Event = m_PendingEvents.AddZeroed_GetRef();
+	Event.m_hConn = Connection.Handle;
+	Event.m_eOldState = Connection.State;
+
+	Connection.State = NewState;
+	if (EndReason != 0)
+	{
+		Connection.EndReason = EndReason;
+	}
+
+	FillConnectionInfo(Connection, Event.m_info);
+}
+
+void FSteamCoreSocketsLoopbackTransport::FillConnectionInfo(const FConnection& Connection, SteamNetConnectionInfo_t& OutInfo) const
+{
+	FMemory::Memzero(OutInfo);
+	OutInfo.m_identityRemote = Connection.RemoteIdentity;
+	OutInfo.m_hListenSocket = Connection.ListenSocket;
+	OutInfo.m_addrRemote = Connection.RemoteAddr;
+	OutInfo.m_eState = Connection.State;
+	OutInfo.m_eEndReason = Connection.EndReason;
+	FCStringAnsi::Strncpy(OutInfo.m_szConnectionDescription, "Loopback", UE_ARRAY_COUNT(OutInfo.m_szConnectionDescription));
+}
+
+TArray<SteamNetConnectionStatusChangedCallback_t> FSteamCoreSocketsLoopbackTransport::TakeStatusEvents()
+{
+	FScopeLock Lock(&m_Lock);
+	PumpLocked(GetTime());
+	TArray<SteamNetConnectionStatusChangedCallback_t> Events = MoveTemp(m_PendingEvents);
+	m_PendingEvents.Reset();
+	return Events;
+}
+
+void FSteamCoreSocketsLoopbackTransport::DispatchStatusEvents(FSteamCoreSocketsSubsystem& Subsystem)
+{
+	// The handler calls back into the transport, so it runs without the lock held
+	TArray<SteamNetConnectionStatusChangedCallback_t> Events = TakeStatusEvents();
+	for (SteamNetConnectionStatusChangedCallback_t& Event : Events)
+	{
+		Subsystem.SteamCoreSocketEventHandler(&Event);
+	}
+}
+
+SteamNetworkingMessage_t* FSteamCoreSocketsLoopbackTransport::AllocateMessage(int32 BufferSize)
+{
+	SteamNetworkingMessage_t* Message = GSteamCoreLoopbackFreeMessages.Pop();
+	if (Message == nullptr)
+	{
+		GSteamCoreLoopbackHeapAllocations.Increment();
+		Message = static_cast<SteamNetworkingMessage_t*>(FMemory::Malloc(sizeof(SteamNetworkingMessage_t)));
+	}
+
+	FMemory::Memzero(*Message);
+	Message->m_conn = k_HSteamNetConnection_Invalid;
+	Message->m_pfnRelease = &FSteamCoreSocketsLoopbackTransport::ReleaseMessage;
+	if (BufferSize > 0)
+	{
+		GSteamCoreLoopbackHeapAllocations.Increment();
+		Message->m_pData = FMemory::Malloc(BufferSize);
+		Message->m_cbSize = BufferSize;
+		Message->m_pfnFreeData = &FSteamCoreSocketsLoopbackTransport::FreeMessageData;
+	}
+	return Message;
+}
+
+void FSteamCoreSocketsLoopbackTransport::ReleaseMessage(SteamNetworkingMessage_t* Message)
+{
+	if (Message->m_pfnFreeData != nullptr)
+	{
+		Message->m_pfnFreeData(Message);
+	}
+	Message->m_pData = nullptr;
+	Message->m_pfnFreeData = nullptr;
+	GSteamCoreLoopbackFreeMessages.Push(Message);
+}
+
+void FSteamCoreSocketsLoopbackTransport::FreeMessageData(SteamNetworkingMessage_t* Message)
+{
+	FMemory::Free(Message->m_pData);
+}
+
+int64 FSteamCoreSocketsLoopbackTransport::GetNumHeapAllocations()
+{
+	return GSteamCoreLoopbackHeapAllocations.GetValue();
+}
+
+void FSteamCoreSocketsLoopbackTransport::TrimMessagePool()
+{
+	while (SteamNetworkingMessage_t* Message = GSteamCoreLoopbackFreeMessages.Pop())
+	{
+		FMemory::Free(Message);
+	}
+}
+#endif
@@ -0,0 +1,170 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Misc/ScopeLock.h"
+#include "SteamCoreSocketsTransport.h"
+
+#if WITH_STEAMCORE
+struct FSteamCoreSocketsLoopbackSettings
+{
+	/** One way delay added to every message */
+	float LatencyMs = 0.0f;
+
+	/** Extra random one way delay in [0, JitterMs] */
+	float JitterMs = 0.0f;
+
+	/** Chance in percent that an unreliable message is dropped */
+	float LossPercent = 0.0f;
+
+	/** Chance in percent that an unreliable message is held back by ReorderDelayMs so later messages overtake it */
+	float ReorderPercent = 0.0f;
+	float ReorderDelayMs = 10.0f;
+
+	/** Send rate reported through the real time status */
+	int32 SendRateBytesPerSec = 1024 * 1024;
+
+	/** Seed for loss, jitter and reorder decisions */
+	int32 Seed = 0;
+
+	/** Time only moves through AdvanceTime, which makes runs repeatable */
+	bool bManualClock = false;
+};
+
+/**
+* In-process transport that connects listen sockets and connections inside one process without touching the network or Steam.
+* Supports IP and P2P listen sockets, poll groups, connection status events, pooled messages and simulated latency, loss and reordering.
+* Reliable messages are never dropped or reordered. All state is behind one lock so the network thread can use it as well.
+*/
+class FSteamCoreSocketsLoopbackTransport : public ISteamCoreSocketsTransport
+{
+public:
+	explicit FSteamCoreSocketsLoopbackTransport(const FSteamCoreSocketsLoopbackSettings& InSettings = FSteamCoreSocketsLoopbackSettings());
+	virtual ~FSteamCoreSocketsLoopbackTransport() override;
+
+	//~ Begin ISteamCoreSocketsTransport Interface
+	virtual HSteamListenSocket CreateListenSocketIP(const SteamNetworkingIPAddr& LocalAddress, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual HSteamListenSocket CreateListenSocketP2P(int32 LocalVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual HSteamNetConnection ConnectByIPAddress(const SteamNetworkingIPAddr& Address, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual HSteamNetConnection ConnectP2P(const SteamNetworkingIdentity& RemoteIdentity, int32 RemoteVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual EResult AcceptConnection(HSteamNetConnection Connection) override;
+	virtual bool CloseConnection(HSteamNetConnection Connection, int32 Reason, const char* Debug, bool bEnableLinger) override;
+	virtual bool CloseListenSocket(HSteamListenSocket ListenSocket) override;
+	virtual HSteamNetPollGroup CreatePollGroup() override;
+	virtual bool DestroyPollGroup(HSteamNetPollGroup PollGroup) override;
+	virtual bool SetConnectionPollGroup(HSteamNetConnection Connection, HSteamNetPollGroup PollGroup) override;
+	virtual EResult SendMessageToConnection(HSteamNetConnection Connection, const void* Data, uint32 Size, int32 SendFlags, int64* OutMessageNumber) override;
+	virtual void SendMessages(int32 NumMessages, SteamNetworkingMessage_t* const* Messages, int64* OutMessageNumberOrResult) override;
+	virtual int32 ReceiveMessagesOnConnection(HSteamNetConnection Connection, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages) override;
+	virtual int32 ReceiveMessagesOnPollGroup(HSteamNetPollGroup PollGroup, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages) override;
+	virtual bool GetConnectionInfo(HSteamNetConnection Connection, SteamNetConnectionInfo_t* OutInfo) override;
+	virtual EResult GetConnectionRealTimeStatus(HSteamNetConnection Connection, SteamNetConnectionRealTimeStatus_t* OutStatus, int32 NumLanes, SteamNetConnectionRealTimeLaneStatus_t* OutLanes) override;
+	virtual EResult ConfigureConnectionLanes(HSteamNetConnection Connection, int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights) override;
+	virtual SteamNetworkingMessage_t* AllocateMessage(int32 BufferSize) override;
+	virtual void DispatchStatusEvents(FSteamCoreSocketsSubsystem& Subsystem) override;
+	virtual bool IsLoopback() const override { return true; }
+	//~ End ISteamCoreSocketsTransport Interface
+
+	void SetSettings(const FSteamCoreSocketsLoopbackSettings& InSettings);
+	FSteamCoreSocketsLoopbackSettings GetSettings() const;
+
+	/** Moves the manual clock forward, does nothing unless bManualClock is set */
+	void AdvanceTime(double Seconds);
+
+	/** Removes and returns the status changes raised since the last call, for driving the transport without a subsystem */
+	TArray<SteamNetConnectionStatusChangedCallback_t> TakeStatusEvents();
+
+	/** Message objects and payload buffers taken from the heap so far */
+	static int64 GetNumHeapAllocations();
+
+	/** Frees pooled message objects that are not in use */
+	static void TrimMessagePool();
+
+private:
+	struct FInFlightMessage
+	{
+		SteamNetworkingMessage_t* Message;
+		double DeliverTime;
+	};
+
+	struct FConnection
+	{
+		HSteamNetConnection Handle = k_HSteamNetConnection_Invalid;
+		HSteamNetConnection Peer = k_HSteamNetConnection_Invalid;
+		HSteamListenSocket ListenSocket = k_HSteamListenSocket_Invalid;
+		HSteamNetPollGroup PollGroup = k_HSteamNetPollGroup_Invalid;
+		ESteamNetworkingConnectionState State = k_ESteamNetworkingConnectionState_None;
+		int32 EndReason = 0;
+		SteamNetworkingIdentity RemoteIdentity;
+		SteamNetworkingIPAddr RemoteAddr;
+		int32 NumLanes = 1;
+		int64 NextMessageNumber = 1;
+		double LastReliableDeliverTime = 0.0;
+
+		/** Messages heading to this connection ordered by delivery time */
+		TArray<FInFlightMessage> InFlight;
+		/** Delivered messages, unless the connection is in a poll group */
+		TArray<SteamNetworkingMessage_t*> Inbox;
+
+		int64 BytesOut = 0;
+		int64 PacketsOut = 0;
+		int64 BytesIn = 0;
+		int64 PacketsIn = 0;
+		int32 UnackedReliableBytes = 0;
+
+		double RateWindowStart = 0.0;
+		int64 RateWindowBytesOut = 0;
+		int64 RateWindowPacketsOut = 0;
+		int64 RateWindowBytesIn = 0;
+		int64 RateWindowPacketsIn = 0;
+		float OutBytesPerSec = 0.0f;
+		float OutPacketsPerSec = 0.0f;
+		float InBytesPerSec = 0.0f;
+		float InPacketsPerSec = 0.0f;
+	};
+
+	struct FListener
+	{
+		HSteamListenSocket Handle = k_HSteamListenSocket_Invalid;
+		bool bIsP2P = false;
+		int32 Port = 0;
+	};
+
+	double GetTime() const;
+	uint32 NextHandle() { return m_NextHandle++; }
+
+	FConnection* FindConnection(HSteamNetConnection Handle) { return m_Connections.Find(Handle); }
+	HSteamNetConnection CreateConnectionPair(const FListener* Listener, const SteamNetworkingIdentity& RemoteIdentity, const SteamNetworkingIPAddr& RemoteAddr);
+	void SetState(FConnection& Connection, ESteamNetworkingConnectionState NewState, int32 EndReason = 0);
+	void FillConnectionInfo(const FConnection& Connection, SteamNetConnectionInfo_t& OutInfo) const;
+	void CloseConnectionLocked(FConnection& Connection, int32 Reason, bool bNotifyPeer);
+
+	/** Takes ownership of Message and routes it from Sender to its peer, returns the message number or a negative EResult */
+	int64 SendLocked(FConnection& Sender, SteamNetworkingMessage_t* Message);
+
+	/** Delivers every in flight message whose time has come */
+	void PumpLocked(double Now);
+	void DeliverLocked(FConnection& Connection, SteamNetworkingMessage_t* Message);
+	void UpdateRatesLocked(FConnection& Connection, double Now);
+
+	static void ReleaseMessage(SteamNetworkingMessage_t* Message);
+	static void FreeMessageData(SteamNetworkingMessage_t* Message);
+
+	mutable FCriticalSection m_Lock;
+	FSteamCoreSocketsLoopbackSettings m_Settings;
+	FRandomStream m_Random;
+	double m_ManualTime;
+	uint32 m_NextHandle;
+	uint16 m_NextClientPort;
+
+	TMap<HSteamNetConnection, FConnection> m_Connections;
+	TMap<HSteamListenSocket, FListener> m_Listeners;
+	TMap<HSteamNetPollGroup, TArray<SteamNetworkingMessage_t*>> m_PollGroups;
+	TArray<SteamNetConnectionStatusChangedCallback_t> m_PendingEvents;
+};
+#endif
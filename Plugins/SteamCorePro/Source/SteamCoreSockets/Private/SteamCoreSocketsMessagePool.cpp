@@ -0,0 +1,93 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#include "SteamCoreSocketsMessagePool.h"
+#include "SteamCoreSocketsSubsystem.h"
+#include "SteamCoreSocketsTransport.h"
+#include "Containers/LockFreeList.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+#if WITH_STEAMCORE
+static TLockFreePointerListUnordered<uint8, PLATFORM_CACHE_LINE_SIZE> GSteamCoreIdleBuffers;
+static FThreadSafeCounter GSteamCoreIdleBufferCount;
+static FThreadSafeCounter64 GSteamCoreHeapAllocations;
+
+SteamNetworkingMessage_t* FSteamCoreSocketsMessagePool::AllocateMessage(int32 PayloadSize)
+{
+	ISteamCoreSocketsTransport* Transport = FSteamCoreSocketsSubsystem::GetTransport();
+	return (Transport != nullptr) ? AllocateMessage(*Transport, PayloadSize) : nullptr;
+}
+
+SteamNetworkingMessage_t* FSteamCoreSocketsMessagePool::AllocateMessage(ISteamCoreSocketsTransport& Transport, int32 PayloadSize)
+{
+	if (PayloadSize <= 0)
+	{
+		return nullptr;
+	}
+
+	if (PayloadSize > PooledBufferSize)
+	{
+		GSteamCoreHeapAllocations.Increment();
+		return Transport.AllocateMessage(PayloadSize);
+	}
+
+	SteamNetworkingMessage_t* Message = Transport.AllocateMessage(0);
+	if (Message == nullptr)
+	{
+		return nullptr;
+	}
+
+	uint8* Buffer = GSteamCoreIdleBuffers.Pop();
+	if (Buffer != nullptr)
+	{
+		GSteamCoreIdleBufferCount.Decrement();
+	}
+	else
+	{
+		GSteamCoreHeapAllocations.Increment();
+		Buffer = static_cast<uint8*>(FMemory::Malloc(PooledBufferSize));
+	}
+
+	Message->m_pData = Buffer;
+	Message->m_cbSize = PayloadSize;
+	Message->m_pfnFreeData = &FSteamCoreSocketsMessagePool::FreePooledBuffer;
+	return Message;
+}
+
+int64 FSteamCoreSocketsMessagePool::GetNumHeapAllocations()
+{
+	return GSteamCoreHeapAllocations.GetValue();
+}
+
+void FSteamCoreSocketsMessagePool::Trim()
+{
+	while (uint8* Buffer = GSteamCoreIdleBuffers.Pop())
+	{
+		GSteamCoreIdleBufferCount.Decrement();
+		FMemory::Free(Buffer);
+	}
+}
+
+void FSteamCoreSocketsMessagePool::FreePooledBuffer(SteamNetworkingMessage_t* Message)
+{
+	uint8* Buffer = static_cast<uint8*>(Message->m_pData);
+	Message->m_pData = nullptr;
+	if (Buffer == nullptr)
+	{
+		return;
+	}
+
+	if (GSteamCoreIdleBufferCount.Increment() <= MaxIdleBuffers)
+	{
+		GSteamCoreIdleBuffers.Push(Buffer);
+	}
+	else
+	{
+		GSteamCoreIdleBufferCount.Decrement();
+		FMemory::Free(Buffer);
+	}
+}
+#endif
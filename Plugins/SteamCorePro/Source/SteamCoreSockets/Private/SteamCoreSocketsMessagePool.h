@@ -0,0 +1,42 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamCoreSocketsPrivate.h"
+
+class ISteamCoreSocketsTransport;
+
+#if WITH_STEAMCORE
+/**
+* Hands out SteamNetworkingMessage_t objects for the batched send path.
+* Payload buffers are recycled through a lock free list because Steam may free sent messages from its own service thread.
+*/
+class FSteamCoreSocketsMessagePool
+{
+public:
+	/** Payload size of a pooled buffer, larger messages get a buffer allocated by Steam */
+	static constexpr int32 PooledBufferSize = 1280;
+
+	/** Upper bound of idle buffers kept around, anything returned past it is freed */
+	static constexpr int32 MaxIdleBuffers = 4096;
+
+	/** Allocates a message with a payload of PayloadSize bytes, returns null if Steam is unavailable */
+	static SteamNetworkingMessage_t* AllocateMessage(int32 PayloadSize);
+
+	/** Same as above with an explicit transport instead of the subsystem's */
+	static SteamNetworkingMessage_t* AllocateMessage(ISteamCoreSocketsTransport& Transport, int32 PayloadSize);
+
+	/** Number of payload buffers taken from the heap so far, for measuring how often the pool runs dry */
+	static int64 GetNumHeapAllocations();
+
+	/** Frees every idle buffer */
+	static void Trim();
+
+private:
+	static void FreePooledBuffer(SteamNetworkingMessage_t* Message);
+};
+#endif
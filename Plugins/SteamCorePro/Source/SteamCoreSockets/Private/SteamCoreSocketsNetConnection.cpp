@@ -10,6 +10,7 @@
 #include "SteamCoreSocketsNetDriver.h"
 #include "SteamCoreSocket.h"
 #include "Net/DataChannel.h"
+#include "Net/DataBunch.h"
 #include "CoreMinimal.h"
 #include "PacketHandlers/StatelessConnectHandlerComponent.h"
 #include "Templates/SharedPointer.h"
@@ -28,6 +29,9 @@ void USteamCoreSocketsNetConnection::CleanUp()
 		FSteamCoreSocketsSubsystem* SocketSub = static_cast<FSteamCoreSocketsSubsystem*>(GetDriver()->GetSocketSubsystem());
 		if (SocketSub != nullptr)
 		{
+			// Send whatever this connection queued, including the close bunch, before its socket goes away
+			static_cast<USteamCoreSocketsNetDriver*>(GetDriver())->FlushOutgoingMessages();
+
 			SocketSub->QueueRemoval(m_ConnectionSocket->m_InternalHandle);
 		}
 	}
@@ -46,6 +50,12 @@ void USteamCoreSocketsNetConnection::InitBase(UNetDriver* InDriver, FSocket* InS
 
 	// Keep a reference to the socket.
 	m_ConnectionSocket = static_cast<FSteamCoreSocket*>(InSocket);
+
+	for (int32 LaneIdx = 0; LaneIdx < (int32)ESteamCoreSocketsTrafficClass::Count; ++LaneIdx)
+	{
+		m_LaneNewestPacketId[LaneIdx] = INDEX_NONE;
+		m_LaneOldestPendingPacketId[LaneIdx] = INDEX_NONE;
+	}
 #endif
 }
 
@@ -134,9 +144,26 @@ void USteamCoreSocketsNetConnection::LowLevelSend(void* Data, int32 CountBits, F
 			return;
 		}
 		
-		if (BytesToSend > 0)
+		const uint16 Lane = SelectPacketLane();
+		m_PacketTrafficClass = ESteamCoreSocketsTrafficClass::Gameplay;
+
+		USteamCoreSocketsNetDriver* SteamNetDriver = static_cast<USteamCoreSocketsNetDriver*>(GetDriver());
+		if (BytesToSend > 0 && SteamNetDriver->bBatchOutgoingMessages)
+		{
+			// Copy the handler output into a pooled message, the driver sends the whole frame at once in TickFlush
+			if (SteamNetworkingMessage_t* Message = m_ConnectionSocket->AllocateSendMessage(BytesToSend, Lane))
+			{
+				FMemory::Memcpy(Message->m_pData, SendData, BytesToSend);
+				SteamNetDriver->QueueOutgoingMessage(Message);
+			}
+			else
+			{
+				UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: LowLevelSend: Could not queue %d bytes of data got error %d"), BytesToSend, (int32)SocketSub->GetLastErrorCode());
+			}
+		}
+		else if (BytesToSend > 0)
 		{
-			if (!m_ConnectionSocket->Send(SendData, BytesToSend, BytesSent))
+			if (!m_ConnectionSocket->SendOnLane(SendData, BytesToSend, BytesSent, Lane))
 			{
 				UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: LowLevelSend: Could not send %d bytes of data got error %d"), BytesToSend, (int32)SocketSub->GetLastErrorCode());
 			}
@@ -150,6 +177,91 @@ void USteamCoreSocketsNetConnection::LowLevelSend(void* Data, int32 CountBits, F
 #endif
 }
 
+int32 USteamCoreSocketsNetConnection::SendRawBunch(FOutBunch& Bunch, bool InAllowMerge, const FNetTraceCollector* BunchCollector)
+{
+#if WITH_STEAMCORE
+	if (m_ConnectionSocket != nullptr && m_ConnectionSocket->m_NumLanes > 1)
+	{
+		// A packet goes out on a single lane, so finish the current one before switching class
+		const ESteamCoreSocketsTrafficClass TrafficClass = ClassifyBunch(Bunch);
+		if (TrafficClass != m_PacketTrafficClass && SendBuffer.GetNumBits() > 0)
+		{
+			FlushNet();
+		}
+
+		m_PacketTrafficClass = TrafficClass;
+		const int32 PacketId = UNetConnection::SendRawBunch(Bunch, InAllowMerge, BunchCollector);
+
+		// The base class may have flushed a full packet, which resets the class
+		m_PacketTrafficClass = TrafficClass;
+		return PacketId;
+	}
+#endif
+	return UNetConnection::SendRawBunch(Bunch, InAllowMerge, BunchCollector);
+}
+
+ESteamCoreSocketsTrafficClass USteamCoreSocketsNetConnection::ClassifyBunch(const FOutBunch& Bunch)
+{
+	if (Bunch.ChName == NAME_Voice)
+	{
+		return ESteamCoreSocketsTrafficClass::Voice;
+	}
+
+	// Reliable bunches only get split when they are too large for a packet, which is initial state or bulk data
+	if (Bunch.bReliable && Bunch.bPartial && Bunch.ChName != NAME_Control)
+	{
+		return ESteamCoreSocketsTrafficClass::Bulk;
+	}
+
+	return ESteamCoreSocketsTrafficClass::Gameplay;
+}
+
+uint16 USteamCoreSocketsNetConnection::SelectPacketLane()
+{
+#if WITH_STEAMCORE
+	if (m_ConnectionSocket == nullptr || m_ConnectionSocket->m_NumLanes < 2 || m_bInConnectionlessHandshake)
+	{
+		return 0;
+	}
+
+	// Handshake packets from the PacketHandler must not queue behind anything
+	if (Handler.IsValid() && !Handler->IsFullyInitialized())
+	{
+		return 0;
+	}
+
+	const USteamCoreSocketsNetDriver* SteamNetDriver = static_cast<const USteamCoreSocketsNetDriver*>(GetDriver());
+	const int32 NumLanes = FMath::Min(m_ConnectionSocket->m_NumLanes, (int32)ESteamCoreSocketsTrafficClass::Count);
+	const int32 PacketId = OutPacketId;
+	uint16 Lane = m_ConnectionSocket->GetLaneForTrafficClass(m_PacketTrafficClass);
+
+	// Everything up to LastNotifiedPacketId was acked or lost, later packets may still be overtaken by one on another lane.
+	// The receiver drops packets that arrive after more than its order correction window, so past that the packet waits behind the oldest one in flight.
+	if (PacketId - LastNotifiedPacketId - 1 >= SteamNetDriver->LaneReorderWindow)
+	{
+		int32 OldestPendingPacketId = MAX_int32;
+		for (int32 LaneIdx = 0; LaneIdx < NumLanes; ++LaneIdx)
+		{
+			if (m_LaneNewestPacketId[LaneIdx] > LastNotifiedPacketId && m_LaneOldestPendingPacketId[LaneIdx] < OldestPendingPacketId)
+			{
+				OldestPendingPacketId = m_LaneOldestPendingPacketId[LaneIdx];
+				Lane = (uint16)LaneIdx;
+			}
+		}
+	}
+
+	if (m_LaneNewestPacketId[Lane] <= LastNotifiedPacketId)
+	{
+		m_LaneOldestPendingPacketId[Lane] = PacketId;
+	}
+	m_LaneNewestPacketId[Lane] = PacketId;
+
+	return Lane;
+#else
+	return 0;
+#endif
+}
+
 FString USteamCoreSocketsNetConnection::LowLevelGetRemoteAddress(bool bAppendPort)
 {
 #if WITH_STEAMCORE
@@ -239,6 +351,6 @@ void USteamCoreSocketsNetConnection::HandleRecvMessage(void* InData, int32 SizeO
 			}
 		}
 	}
-	UNetConnection::ReceivedRawPacket(RecvData, SizeOfData);
+	ReceivedRawPacket(RecvData, SizeOfData);
 #endif
 }
@@ -11,13 +11,53 @@
 #include "SteamCoreSocketsModule.h"
 #include "SteamCoreSocket.h"
 #include "SteamCoreSocketsNetConnection.h"
+#include "SteamCoreSocketsIOThread.h"
 #include "SteamCoreSocketsSubsystem.h"
+#include "SteamCoreSocketsTransport.h"
 #include "IPAddressSteamCoreSockets.h"
 #include "Engine/NetworkDelegates.h"
 #include "Engine/World.h"
 #include "Misc/CommandLine.h"
+#include "HAL/IConsoleManager.h"
 #include "PacketHandler.h"
 
+/** An engine cvar changed for lane drivers, with the value it had before the first of them touched it */
+struct FSteamCorePacketOrderCvar
+{
+	IConsoleVariable* Variable;
+	int32 Original;
+	int32 Applied;
+};
+
+// Packet order correction is engine wide, so it is shared by every driver using lanes. Game thread only.
+static int32 GSteamCorePacketOrderUsers = 0;
+static TArray<FSteamCorePacketOrderCvar> GSteamCorePacketOrderCvars;
+
+static void ApplyPacketOrderCvar(IConsoleVariable* Variable, int32 Value)
+{
+	FSteamCorePacketOrderCvar* Saved = GSteamCorePacketOrderCvars.FindByPredicate([Variable](const FSteamCorePacketOrderCvar& Entry) { return Entry.Variable == Variable; });
+	if (Saved == nullptr)
+	{
+		Saved = &GSteamCorePacketOrderCvars.Add_GetRef({ Variable, Variable->GetInt(), 0 });
+	}
+
+	Variable->Set(Value, ECVF_SetByCode);
+	Saved->Applied = Variable->GetInt();
+}
+
+static void RestorePacketOrderCvars()
+{
+	for (const FSteamCorePacketOrderCvar& Saved : GSteamCorePacketOrderCvars)
+	{
+		// Values changed from config or the console since are left as they are
+		if (Saved.Variable->GetInt() == Saved.Applied)
+		{
+			Saved.Variable->Set(Saved.Original, ECVF_SetByCode);
+		}
+	}
+	GSteamCorePacketOrderCvars.Reset();
+}
+
 void USteamCoreSocketsNetDriver::PostInitProperties()
 {
 	Super::PostInitProperties();
@@ -27,6 +67,9 @@ void USteamCoreSocketsNetDriver::Shutdown()
 {
 #if WITH_STEAMCORE
 	UE_LOG(LogSockets, Verbose, TEXT("SteamCoreSockets: Shutdown called on netdriver"));
+	FlushOutgoingMessages();
+	StopNetworkThread();
+
 	FSteamCoreSocketsSubsystem* SocketSub = static_cast<FSteamCoreSocketsSubsystem*>(GetSocketSubsystem());
 	if (SocketSub && m_Socket)
 	{
@@ -40,8 +83,12 @@ void USteamCoreSocketsNetDriver::Shutdown()
 
 		m_Socket = nullptr;
 	}
+
+	m_ConnectionsByHandle.Empty();
 #endif
 
+	ReleasePacketOrderCorrection();
+
 	Super::Shutdown();
 }
 
@@ -181,6 +228,12 @@ bool USteamCoreSocketsNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* In
 		UE_LOG(LogNet, Error, TEXT("SteamCoreSockets: Invalid binding address used to create socket"));
 		return false;
 	}
+
+	if (bUseConnectionLanes && !EnablePacketOrderCorrection())
+	{
+		UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: %s cannot enable packet order correction, connection lanes are disabled"), *GetDescription());
+		bUseConnectionLanes = false;
+	}
 	
 	return true;
 #else
@@ -230,6 +283,8 @@ bool USteamCoreSocketsNetDriver::InitConnect(FNetworkNotify* InNotify, const FUR
 		return false;
 	}
 
+	ConfigureConnectionLanes(m_Socket);
+
 	// Link connection information for later
 	SteamSubsystem->LinkNetDriver(m_Socket, this);
 
@@ -291,86 +346,297 @@ void USteamCoreSocketsNetDriver::TickDispatch(float DeltaTime)
 	// Do this first to clean up dead connections so we don't waste time processing them.
 	UNetDriver::TickDispatch(DeltaTime);
 
-	bool bIsAServer = (ServerConnection == nullptr);
 	FSteamCoreSocketsSubsystem* SteamSubsystem = static_cast<FSteamCoreSocketsSubsystem*>(GetSocketSubsystem());
 
-	// Receive packets until we cannot any longer.
+	const int32 BatchSize = FMath::Clamp(ReceiveBatchSize, 1, 256);
+	if (m_ReceiveBuffer.Num() != BatchSize)
+	{
+		m_ReceiveBuffer.SetNumZeroed(BatchSize);
+	}
+
+	if (bUseNetworkThread && !m_bIsDelayedNetworkAccess && m_Socket != nullptr)
+	{
+		if (!m_IOThread.IsValid())
+		{
+			StartNetworkThread();
+		}
+
+		if (m_IOThread.IsValid())
+		{
+			// Drain what the network thread has received so far, new arrivals are picked up next tick
+			int32 MessagesRead = 0;
+			do
+			{
+				MessagesRead = 0;
+				while (MessagesRead < BatchSize && m_IOThread->DequeueReceived(m_ReceiveBuffer[MessagesRead]))
+				{
+					++MessagesRead;
+				}
+				DispatchMessages(m_ReceiveBuffer.GetData(), MessagesRead);
+			}
+			while (MessagesRead == BatchSize && m_IOThread.IsValid());
+
+			CountNetworkThreadSends();
+			return;
+		}
+	}
+
+	// Receive packets in batches until we cannot any longer.
 	while (!m_bIsDelayedNetworkAccess)
 	{
 		// This could be placed out of the loop, however if we thread API event calls, this will need to be checked on every recv
-		if (m_Socket != nullptr)
+		if (m_Socket == nullptr)
 		{
+			// Silently exit if the socket is invalid.
+			return;
+		}
 
 #if !UE_BUILD_SHIPPING
-			// This code causes peek cycles to run in order to test if the functionality works properly.
-			if (SteamSubsystem && SteamSubsystem->m_bShouldTestPeek)
+		// This code causes peek cycles to run in order to test if the functionality works properly.
+		if (SteamSubsystem && SteamSubsystem->m_bShouldTestPeek)
+		{
+			uint32 PendingDataSize;
+			if (m_Socket->HasPendingData(PendingDataSize))
 			{
-				uint32 PendingDataSize;
-				if (m_Socket->HasPendingData(PendingDataSize))
-				{
-					UE_LOG(LogNet, Verbose, TEXT("SteamCoreSockets: handle %u has %u data pending on the socket"), m_Socket->m_InternalHandle, PendingDataSize);
-				}
+				UE_LOG(LogNet, Verbose, TEXT("SteamCoreSockets: handle %u has %u data pending on the socket"), m_Socket->m_InternalHandle, PendingDataSize);
 			}
+		}
 #endif
-			int32 BytesRead = 0;
-			SteamNetworkingMessage_t* Message;
-			// Attempt to grab a message using the Socket
-			if (m_Socket->RecvRaw(Message, 1, BytesRead) && BytesRead > 0 && Message != nullptr)
-			{
+		int32 MessagesRead = 0;
+		if (!m_Socket->RecvRawBatch(m_ReceiveBuffer.GetData(), BatchSize, MessagesRead))
+		{
+			// In theory, we should have no information what so ever about connections that failed.
+			// The sender should have no information in here and this should only happen if our handle is null.
+
+			// A later disconnection event message from the API should handle cleanup of this object.
+			UE_CLOG(SteamSubsystem, LogNet, Warning, TEXT("SteamCoreSockets: Could not recv message, got error code %d"), SteamSubsystem->GetLastErrorCode());
+			break;
+		}
+
+		if (MessagesRead == 0)
+		{
+			// We have no more messages, leave.
+			UE_LOG(LogNet, VeryVerbose, TEXT("SteamCoreSockets: Exhausted message, exiting loop."));
+			break;
+		}
+
+		DispatchMessages(m_ReceiveBuffer.GetData(), MessagesRead);
+
+		// A partial batch means the queue is drained, skip the extra empty receive call
+		if (MessagesRead < BatchSize)
+		{
+			break;
+		}
+	}
+#endif
+	return;
+}
+
+void USteamCoreSocketsNetDriver::DispatchMessages(SteamNetworkingMessage_t** Messages, int32 NumMessages)
+{
+#if WITH_STEAMCORE
+	const bool bIsAServer = (ServerConnection == nullptr);
+
+	for (int32 MessageIdx = 0; MessageIdx < NumMessages; ++MessageIdx)
+	{
+		SteamNetworkingMessage_t* Message = Messages[MessageIdx];
+		if (Message == nullptr || Message->GetSize() == 0)
+		{
+			continue;
+		}
+
 #if UE_VERSION_OLDER_THAN(5,0,0)
-				USteamCoreSocketsNetConnection* ConnectionToHandleMessage = static_cast<USteamCoreSocketsNetConnection*>((bIsAServer) ? FindClientConnectionForHandle(Message->m_conn) : ServerConnection);
+		USteamCoreSocketsNetConnection* ConnectionToHandleMessage = static_cast<USteamCoreSocketsNetConnection*>((bIsAServer) ? FindClientConnectionForHandle(Message->m_conn) : ServerConnection);
 #else
-				USteamCoreSocketsNetConnection* ConnectionToHandleMessage = static_cast<USteamCoreSocketsNetConnection*>((bIsAServer) ? FindClientConnectionForHandle(Message->m_conn) : ToRawPtr(ServerConnection));
+		USteamCoreSocketsNetConnection* ConnectionToHandleMessage = static_cast<USteamCoreSocketsNetConnection*>((bIsAServer) ? FindClientConnectionForHandle(Message->m_conn) : ToRawPtr(ServerConnection));
 #endif
 
-				// Grab sender information for the purposes of logging
-				FInternetAddrSteamCoreSockets MessageSender(Message->m_identityPeer);
+		// Grab sender information for the purposes of logging
+		FInternetAddrSteamCoreSockets MessageSender(Message->m_identityPeer);
 
-				// Set the P2P channel information if we're not over IP (which will already have the right data set)
-				if (MessageSender.GetProtocolType() != FNetworkProtocolTypes::SteamCoreSocketsIP)
-				{
-					MessageSender.SetPort(Message->m_nChannel);
-				}
+		// Set the P2P channel information if we're not over IP (which will already have the right data set)
+		if (MessageSender.GetProtocolType() != FNetworkProtocolTypes::SteamCoreSocketsIP)
+		{
+			MessageSender.SetPort(Message->m_nChannel);
+		}
 
-				// Process the message for this connection.
-				if (ConnectionToHandleMessage != nullptr)
-				{
-					UE_LOG(LogNet, VeryVerbose, TEXT("SteamCoreSockets: Recieved packet from %s with size %d"), *MessageSender.ToString(true), Message->GetSize());
-					ConnectionToHandleMessage->HandleRecvMessage(Message->m_pData, Message->GetSize(), &MessageSender);
-					Message->Release();
-					continue;
-				}
-				else
-				{
-					UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: Could not find connection information for sender %s (handle: %u)"), *MessageSender.ToString(true), Message->m_conn);
-					Message->Release();
-					continue;
-				}
-			}
-			else if (BytesRead == 0)
-			{
-				// We have no more messages, leave.
-				UE_LOG(LogNet, VeryVerbose, TEXT("SteamCoreSockets: Exhausted message, exiting loop."));
-				break;
-			}
-			else
-			{
-				// In theory, we should have no information what so ever about connections that failed.
-				// The sender should have no information in here and this should only happen if our handle is null.
+		// Process the message for this connection.
+		if (ConnectionToHandleMessage != nullptr)
+		{
+			UE_LOG(LogNet, VeryVerbose, TEXT("SteamCoreSockets: Recieved packet from %s with size %d"), *MessageSender.ToString(true), Message->GetSize());
+			ConnectionToHandleMessage->HandleRecvMessage(Message->m_pData, Message->GetSize(), &MessageSender);
+		}
+		else
+		{
+			UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: Could not find connection information for sender %s (handle: %u)"), *MessageSender.ToString(true), Message->m_conn);
+		}
+	}
 
-				// A later disconnection event message from the API should handle cleanup of this object.
-				UE_CLOG(SteamSubsystem, LogNet, Warning, TEXT("SteamCoreSockets: Could not recv message, got error code %d"), SteamSubsystem->GetLastErrorCode());
-				break;
-			}
+	// Release the whole batch once every message has been dispatched
+	for (int32 MessageIdx = 0; MessageIdx < NumMessages; ++MessageIdx)
+	{
+		if (Messages[MessageIdx] != nullptr)
+		{
+			Messages[MessageIdx]->Release();
+			Messages[MessageIdx] = nullptr;
+		}
+	}
+#endif
+}
+
+void USteamCoreSocketsNetDriver::StartNetworkThread()
+{
+#if WITH_STEAMCORE
+	if (m_Socket == nullptr || m_IOThread.IsValid())
+	{
+		return;
+	}
+
+	const HSteamNetPollGroup PollGroup = m_Socket->m_bIsListenSocket ? m_Socket->m_PollGroup : k_HSteamNetPollGroup_Invalid;
+	TSharedPtr<FSteamCoreSocketsIOThread> IOThread = MakeShared<FSteamCoreSocketsIOThread>(PollGroup, m_Socket->m_InternalHandle, ReceiveBatchSize, NetworkThreadWaitMs);
+
+	// A peeked message would otherwise be delivered after everything the thread receives
+	if (m_Socket->m_bHasPendingData && m_Socket->m_PendingData != nullptr)
+	{
+		DispatchMessages(&m_Socket->m_PendingData, 1);
+		m_Socket->m_bHasPendingData = false;
+	}
+
+	if (IOThread->Start(FString::Printf(TEXT("SteamCoreSocketsIO_%u"), m_Socket->m_InternalHandle)))
+	{
+		m_IOThread = IOThread;
+		UE_LOG(LogNet, Log, TEXT("SteamCoreSockets: %s started network thread for handle %u"), *GetDescription(), m_Socket->m_InternalHandle);
+	}
+	else
+	{
+		UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: %s could not start network thread, receiving on the game thread"), *GetDescription());
+		bUseNetworkThread = false;
+	}
+#endif
+}
+
+void USteamCoreSocketsNetDriver::StopNetworkThread()
+{
+#if WITH_STEAMCORE
+	if (m_IOThread.IsValid())
+	{
+		// Joins the thread and sends what it still had queued, resetting it frees unprocessed messages
+		m_IOThread->StopAndFlush();
+		CountNetworkThreadSends();
+		m_IOThread.Reset();
+	}
+#endif
+}
+
+void USteamCoreSocketsNetDriver::CountNetworkThreadSends()
+{
+#if WITH_STEAMCORE
+	TArray<FSteamCoreSocketsSentMessage> Sent;
+	while (m_IOThread.IsValid() && m_IOThread->DequeueSent(Sent))
+	{
+		CountSentMessages(Sent);
+	}
+#endif
+}
+
+void USteamCoreSocketsNetDriver::CountSentMessages(TConstArrayView<FSteamCoreSocketsSentMessage> SentMessages)
+{
+#if WITH_STEAMCORE
+	FSteamCoreSocketsSubsystem* SocketSub = static_cast<FSteamCoreSocketsSubsystem*>(GetSocketSubsystem());
+	if (SocketSub == nullptr)
+	{
+		return;
+	}
+
+	// A frame usually holds runs of messages for the same connection
+	SteamCoreSocketHandles LastHandle = k_HSteamNetConnection_Invalid;
+	FSteamCoreSocket* Socket = nullptr;
+	for (const FSteamCoreSocketsSentMessage& Sent : SentMessages)
+	{
+		if (Sent.Connection != LastHandle)
+		{
+			LastHandle = Sent.Connection;
+			const FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation* SocketInfo = SocketSub->GetSocketInfo(Sent.Connection);
+			Socket = (SocketInfo != nullptr) ? SocketInfo->m_Socket : nullptr;
+		}
+
+		if (Socket != nullptr)
+		{
+			Socket->CountLaneSend(Sent.Lane, Sent.Size);
+		}
+	}
+#endif
+}
+
+void USteamCoreSocketsNetDriver::TickFlush(float DeltaSeconds)
+{
+	Super::TickFlush(DeltaSeconds);
+
+	FlushOutgoingMessages();
+}
+
+void USteamCoreSocketsNetDriver::FlushOutgoingMessages()
+{
+#if WITH_STEAMCORE
+	const int32 NumMessages = m_OutgoingMessages.Num();
+	if (NumMessages == 0)
+	{
+		return;
+	}
+
+	ISteamCoreSocketsTransport* SocketInterface = FSteamCoreSocketsSubsystem::GetTransport();
+	if (SocketInterface == nullptr)
+	{
+		UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: FlushOutgoingMessages: No sockets interface, dropping %d queued messages"), NumMessages);
+		for (SteamNetworkingMessage_t* Message : m_OutgoingMessages)
+		{
+			Message->Release();
+		}
+		m_OutgoingMessages.Reset();
+		return;
+	}
+
+	if (m_IOThread.IsValid())
+	{
+		m_IOThread->QueueSend(MoveTemp(m_OutgoingMessages));
+		m_OutgoingMessages.Reset();
+		return;
+	}
+
+	m_OutgoingResults.Reset();
+	m_OutgoingResults.AddUninitialized(NumMessages);
+
+	// Steam releases the messages, keep what the lane stats need before sending
+	m_OutgoingSent.Reset();
+	for (const SteamNetworkingMessage_t* Message : m_OutgoingMessages)
+	{
+		m_OutgoingSent.Add({ Message->m_conn, (uint16)Message->m_idxLane, Message->m_cbSize });
+	}
+
+	// Steam takes ownership of every message whether or not it could be sent
+	SocketInterface->SendMessages(NumMessages, m_OutgoingMessages.GetData(), m_OutgoingResults.GetData());
+	m_OutgoingMessages.Reset();
+
+	int32 NumSent = 0;
+	int64 LastFailure = 0;
+	for (int32 MessageIdx = 0; MessageIdx < NumMessages; ++MessageIdx)
+	{
+		const int64 Result = m_OutgoingResults[MessageIdx];
+		if (Result < 0)
+		{
+			LastFailure = -Result;
 		}
 		else
 		{
-			// Silently exit if the socket is invalid.
-			return;
+			m_OutgoingSent[NumSent++] = m_OutgoingSent[MessageIdx];
 		}
 	}
+	m_OutgoingSent.SetNum(NumSent, EAllowShrinking::No);
+	CountSentMessages(m_OutgoingSent);
+
+	const int32 NumFailed = NumMessages - NumSent;
+	UE_CLOG(NumFailed > 0, LogNet, Warning, TEXT("SteamCoreSockets: FlushOutgoingMessages: %d of %d messages could not be sent, last result %lld"), NumFailed, NumMessages, LastFailure);
 #endif
-	return;
 }
 
 void USteamCoreSocketsNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits)
@@ -424,6 +690,8 @@ void USteamCoreSocketsNetDriver::LowLevelDestroy()
 	FSteamCoreSocketsSubsystem* SteamSubsystem = static_cast<FSteamCoreSocketsSubsystem*>(GetSocketSubsystem());
 	if (m_Socket != nullptr && !HasAnyFlags(RF_ClassDefaultObject))
 	{
+		FlushOutgoingMessages();
+		StopNetworkThread();
 		SteamSubsystem->QueueRemoval(m_Socket->m_InternalHandle);
 		m_Socket = nullptr;
 
@@ -469,10 +737,13 @@ void USteamCoreSocketsNetDriver::ResetSocketInfo(const FSteamCoreSocket* Removed
 	{
 		SocketConnection->ClearSocket();
 	}
+	m_ConnectionsByHandle.Remove(SocketHandle);
 
 	// If this netdriver has the same socket pointer, go ahead and remove it.
 	if (m_Socket == RemovedSocket)
 	{
+		// The network thread polls the removed socket's poll group, TickDispatch starts a new one once a socket is assigned again
+		StopNetworkThread();
 		m_Socket = nullptr;
 	}
 #endif
@@ -481,20 +752,30 @@ void USteamCoreSocketsNetDriver::ResetSocketInfo(const FSteamCoreSocket* Removed
 UNetConnection* USteamCoreSocketsNetDriver::FindClientConnectionForHandle(SteamCoreSocketHandles SocketHandle)
 {
 #if WITH_STEAMCORE
-	for (const auto& ClientConnection : ClientConnections)
+	USteamCoreSocketsNetConnection* const* SteamConnection = m_ConnectionsByHandle.Find(SocketHandle);
+	if (SteamConnection)
 	{
-		const USteamCoreSocketsNetConnection* SteamConnection = static_cast<USteamCoreSocketsNetConnection*>(ClientConnection);
-		if (SteamConnection && SteamConnection->GetRawSocket() != nullptr)
+		return *SteamConnection;
+	}
+#endif
+	return nullptr;
+}
+
+void USteamCoreSocketsNetDriver::RemoveClientConnection(UNetConnection* ClientConnectionToRemove)
+{
+#if WITH_STEAMCORE
+	// Connections can be cleaned up by the engine before the API reports the disconnect, drop the route here as well.
+	for (auto It = m_ConnectionsByHandle.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == ClientConnectionToRemove)
 		{
-			const FSteamCoreSocket* SteamSocket = SteamConnection->GetRawSocket();
-			if (SteamSocket && SteamSocket->m_InternalHandle == SocketHandle)
-			{
-				return ClientConnection;
-			}
+			It.RemoveCurrent();
+			break;
 		}
 	}
 #endif
-	return nullptr;
+
+	Super::RemoveClientConnection(ClientConnectionToRemove);
 }
 
 void USteamCoreSocketsNetDriver::OnConnectionCreated(SteamCoreSocketHandles ListenParentHandle, SteamCoreSocketHandles SocketHandle)
@@ -511,14 +792,14 @@ void USteamCoreSocketsNetDriver::OnConnectionCreated(SteamCoreSocketHandles List
 	}
 
 	// Absolutely make sure that we can interface with the SteamAPI
-	check(FSteamCoreSocketsSubsystem::GetSteamSocketsInterface());
+	check(FSteamCoreSocketsSubsystem::GetTransport());
 
 	// Unlike the other SteamNetworking functionality, connections that we don't want cannot just be ignored
 	// So instead of processing everything and then disconnecting unwanted connections, we drop them immediately.
 	if (Notify != nullptr && Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept)
 	{
 		// Accept the connection with the API. We'll want to do this as quick as possible.
-		EResult AcceptedResult = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface()->AcceptConnection(SocketHandle);
+		EResult AcceptedResult = FSteamCoreSocketsSubsystem::GetTransport()->AcceptConnection(SocketHandle);
 		if (AcceptedResult != k_EResultOK)
 		{
 			// We can fail here because the client aborted or something happened to our connection to the network
@@ -535,8 +816,9 @@ void USteamCoreSocketsNetDriver::OnConnectionCreated(SteamCoreSocketHandles List
 		FInternetAddrSteamCoreSockets ConnectedAddr;
 		FSteamCoreSocket* NewSocket = static_cast<FSteamCoreSocket*>(m_Socket->Accept(TEXT("AcceptedSocket")));
 		NewSocket->m_InternalHandle = SocketHandle;
+		ConfigureConnectionLanes(NewSocket);
 
-		SocketSubsystem->GetSteamSocketsInterface()->SetConnectionPollGroup(SocketHandle, m_Socket->m_PollGroup);
+		FSteamCoreSocketsSubsystem::GetTransport()->SetConnectionPollGroup(SocketHandle, m_Socket->m_PollGroup);
 
 		NewSocket->GetPeerAddress(ConnectedAddr);
 		SocketSubsystem->AddSocket(ConnectedAddr, NewSocket, m_Socket);
@@ -552,7 +834,7 @@ void USteamCoreSocketsNetDriver::OnConnectionCreated(SteamCoreSocketHandles List
 		int nLanes = 0;
 		SteamNetConnectionRealTimeLaneStatus_t* pLanes = NULL;
 		
-		if (FSteamCoreSocketsSubsystem::GetSteamSocketsInterface()->GetConnectionRealTimeStatus(SocketHandle, &ConnStatus, nLanes, pLanes) && ConnStatus.m_eState == k_ESteamNetworkingConnectionState_Connected)
+		if (FSteamCoreSocketsSubsystem::GetTransport()->GetConnectionRealTimeStatus(SocketHandle, &ConnStatus, nLanes, pLanes) && ConnStatus.m_eState == k_ESteamNetworkingConnectionState_Connected)
 		{
 			// We have already found a route and made a connection, skip out of pending.
 			RemoteConnectionState = USOCK_Open;
@@ -580,17 +862,109 @@ void USteamCoreSocketsNetDriver::OnConnectionCreated(SteamCoreSocketHandles List
 
 		Notify->NotifyAcceptedConnection(NewConnection);
 		AddClientConnection(NewConnection);
+		m_ConnectionsByHandle.Add(SocketHandle, NewConnection);
 
 		UE_LOG(LogNet, Log, TEXT("SteamCoreSockets: New connection (%u) over listening socket accepted %s"), SocketHandle, *ConnectedAddr.ToString(true));
 	}
 	else
 	{
-		FSteamCoreSocketsSubsystem::GetSteamSocketsInterface()->CloseConnection(SocketHandle, k_ESteamNetConnectionEnd_App_Generic, "Connection rejected", false);
+		FSteamCoreSocketsSubsystem::GetTransport()->CloseConnection(SocketHandle, k_ESteamNetConnectionEnd_App_Generic, "Connection rejected", false);
 		UE_LOG(LogNet, Log, TEXT("SteamCoreSockets: New connection over listening socket rejected."));
 	}
 #endif
 }
 
+bool USteamCoreSocketsNetDriver::EnablePacketOrderCorrection()
+{
+	IConsoleManager& ConsoleManager = IConsoleManager::Get();
+	IConsoleVariable* DoCorrection = ConsoleManager.FindConsoleVariable(TEXT("net.DoPacketOrderCorrection"));
+	IConsoleVariable* EnableThreshold = ConsoleManager.FindConsoleVariable(TEXT("net.PacketOrderCorrectionEnableThreshold"));
+	IConsoleVariable* MaxMissingPackets = ConsoleManager.FindConsoleVariable(TEXT("net.PacketOrderMaxMissingPackets"));
+	IConsoleVariable* MaxCachedPackets = ConsoleManager.FindConsoleVariable(TEXT("net.PacketOrderMaxCachedPackets"));
+	if (DoCorrection == nullptr || EnableThreshold == nullptr || MaxMissingPackets == nullptr || MaxCachedPackets == nullptr)
+	{
+		return false;
+	}
+
+	if (!m_bUsesPacketOrderCorrection)
+	{
+		m_bUsesPacketOrderCorrection = true;
+		GSteamCorePacketOrderUsers++;
+	}
+
+	// These are engine wide, only ever move them towards more correction. The last lane driver to shut down restores them
+	const int32 RequestedWindow = FMath::Max(LaneReorderWindow, 1);
+	if (DoCorrection->GetInt() == 0)
+	{
+		ApplyPacketOrderCvar(DoCorrection, 1);
+	}
+	if (EnableThreshold->GetInt() > 0)
+	{
+		// Correct from the first overtaken packet instead of after one has been lost
+		ApplyPacketOrderCvar(EnableThreshold, 0);
+	}
+	if (MaxMissingPackets->GetInt() < RequestedWindow)
+	{
+		ApplyPacketOrderCvar(MaxMissingPackets, RequestedWindow);
+	}
+
+	// Values set from config or the console take precedence, go by what actually applies
+	if (DoCorrection->GetInt() == 0)
+	{
+		ReleasePacketOrderCorrection();
+		return false;
+	}
+
+	LaneReorderWindow = FMath::Min3(RequestedWindow, MaxMissingPackets->GetInt(), MaxCachedPackets->GetInt());
+	if (LaneReorderWindow <= 0)
+	{
+		ReleasePacketOrderCorrection();
+		return false;
+	}
+
+	UE_CLOG(EnableThreshold->GetInt() > 0, LogNet, Warning, TEXT("SteamCoreSockets: net.PacketOrderCorrectionEnableThreshold is %d, packets overtaken on another lane are lost until correction starts"), EnableThreshold->GetInt());
+	UE_LOG(LogNet, Log, TEXT("SteamCoreSockets: %s packets may overtake up to %d unacknowledged packets on other lanes"), *GetDescription(), LaneReorderWindow);
+	return true;
+}
+
+void USteamCoreSocketsNetDriver::ReleasePacketOrderCorrection()
+{
+	if (!m_bUsesPacketOrderCorrection)
+	{
+		return;
+	}
+
+	m_bUsesPacketOrderCorrection = false;
+	if (--GSteamCorePacketOrderUsers == 0)
+	{
+		RestorePacketOrderCvars();
+	}
+}
+
+void USteamCoreSocketsNetDriver::ConfigureConnectionLanes(FSteamCoreSocket* ConnectionSocket) const
+{
+#if WITH_STEAMCORE
+	if (!bUseConnectionLanes || ConnectionSocket == nullptr)
+	{
+		return;
+	}
+
+	const int32 LanePriorities[] = { GameplayLanePriority, VoiceLanePriority, BulkLanePriority };
+	const uint16 LaneWeights[] =
+	{
+		(uint16)FMath::Clamp(GameplayLaneWeight, 1, (int32)MAX_uint16),
+		(uint16)FMath::Clamp(VoiceLaneWeight, 1, (int32)MAX_uint16),
+		(uint16)FMath::Clamp(BulkLaneWeight, 1, (int32)MAX_uint16)
+	};
+	static_assert(UE_ARRAY_COUNT(LanePriorities) == (int32)ESteamCoreSocketsTrafficClass::Count, "One lane per traffic class");
+
+	if (!ConnectionSocket->ConfigureLanes((int32)ESteamCoreSocketsTrafficClass::Count, LanePriorities, LaneWeights))
+	{
+		UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: %s connection %u did not take %d lanes, all of its traffic shares one lane"), *GetDescription(), ConnectionSocket->m_InternalHandle, (int32)ESteamCoreSocketsTrafficClass::Count);
+	}
+#endif
+}
+
 void USteamCoreSocketsNetDriver::OnConnectionUpdated(SteamCoreSocketHandles SocketHandle, int32 NewState)
 {
 #if WITH_STEAMCORE
@@ -614,6 +988,17 @@ void USteamCoreSocketsNetDriver::OnConnectionUpdated(SteamCoreSocketHandles Sock
 
 		UE_LOG(LogNet, Verbose, TEXT("SteamCoreSockets: Connection established with user with socket id: %u"), SocketHandle);
 
+		// Steam has no lane handshake, each side only knows the lanes it configured itself
+		if (bUseConnectionLanes)
+		{
+			FSteamCoreSocketsSubsystem* SocketSub = static_cast<FSteamCoreSocketsSubsystem*>(GetSocketSubsystem());
+			FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation* SocketInfo = SocketSub ? SocketSub->GetSocketInfo(SocketHandle) : nullptr;
+			if (SocketInfo && SocketInfo->m_Socket && SocketInfo->m_Socket->m_NumLanes < (int32)ESteamCoreSocketsTrafficClass::Count)
+			{
+				UE_LOG(LogNet, Warning, TEXT("SteamCoreSockets: Connection %u is open with %d lane(s) instead of %d"), SocketHandle, SocketInfo->m_Socket->m_NumLanes, (int32)ESteamCoreSocketsTrafficClass::Count);
+			}
+		}
+
 		// For clients, we need to match the settings of the server
 		if (ServerConnection && ArePacketHandlersDisabled())
 		{
@@ -645,6 +1030,9 @@ void USteamCoreSocketsNetDriver::OnConnectionDisconnected(SteamCoreSocketHandles
 #endif
 	}
 
+	// No more packets will be routed to this handle
+	m_ConnectionsByHandle.Remove(SocketHandle);
+
 	UE_LOG(LogNet, Verbose, TEXT("SteamCoreSockets: Connection dropped with user with socket id: %u"), SocketHandle);
 #endif
 }
\ No newline at end of file
@@ -7,22 +7,71 @@
 #include "Misc/CommandLine.h"
 #include "Misc/CoreMisc.h"
 #include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "IPAddressSteamCoreSockets.h"
 #include "SteamCoreSocketsPrivate.h"
 #include "SteamCoreSocketsTaskManager.h"
 #include "SteamCoreSocketsNetDriver.h"
 #include "SteamCoreSharedModule.h"
 #include "SteamCoreSocket.h"
+#include "SteamCoreSocketsMessagePool.h"
+#include "SteamCoreSocketsTransport.h"
+#include "SteamCoreSocketsLoopbackTransport.h"
+#include "SteamCoreSocketsBenchmark.h"
 #include "SteamCoreSocketsPing.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemSteamCore.h"
 #include "SteamCoreSocketsTypes.h"
 #include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Trace/Trace.inl"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSteamCoreSocketsAPI, Log, All);
 
 #if WITH_STEAMCORE
 
+DECLARE_STATS_GROUP(TEXT("SteamCoreSockets"), STATGROUP_SteamCoreSockets, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Connections"), STAT_SteamCoreSockets_Connections, STATGROUP_SteamCoreSockets);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Max Ping (ms)"), STAT_SteamCoreSockets_MaxPing, STATGROUP_SteamCoreSockets);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Average Ping (ms)"), STAT_SteamCoreSockets_AveragePing, STATGROUP_SteamCoreSockets);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Min Quality"), STAT_SteamCoreSockets_MinQuality, STATGROUP_SteamCoreSockets);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Out Bytes/s"), STAT_SteamCoreSockets_OutBytesPerSec, STATGROUP_SteamCoreSockets);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("In Bytes/s"), STAT_SteamCoreSockets_InBytesPerSec, STATGROUP_SteamCoreSockets);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Unreliable Bytes"), STAT_SteamCoreSockets_PendingUnreliable, STATGROUP_SteamCoreSockets);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Reliable Bytes"), STAT_SteamCoreSockets_PendingReliable, STATGROUP_SteamCoreSockets);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Unacked Reliable Bytes"), STAT_SteamCoreSockets_SentUnackedReliable, STATGROUP_SteamCoreSockets);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Max Queue Time (ms)"), STAT_SteamCoreSockets_MaxQueueTime, STATGROUP_SteamCoreSockets);
+
+CSV_DEFINE_CATEGORY(SteamCoreSockets, true);
+
+TRACE_DECLARE_INT_COUNTER(SteamCoreSockets_Connections, TEXT("SteamCoreSockets/Connections"));
+TRACE_DECLARE_INT_COUNTER(SteamCoreSockets_MaxPing, TEXT("SteamCoreSockets/MaxPing"));
+TRACE_DECLARE_FLOAT_COUNTER(SteamCoreSockets_MinQuality, TEXT("SteamCoreSockets/MinQuality"));
+TRACE_DECLARE_INT_COUNTER(SteamCoreSockets_PendingReliable, TEXT("SteamCoreSockets/PendingReliableBytes"));
+TRACE_DECLARE_INT_COUNTER(SteamCoreSockets_PendingUnreliable, TEXT("SteamCoreSockets/PendingUnreliableBytes"));
+
+UE_TRACE_CHANNEL_DEFINE(SteamCoreSocketsChannel)
+
+UE_TRACE_EVENT_BEGIN(SteamCoreSockets, ConnectionStats)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Handle)
+	UE_TRACE_EVENT_FIELD(int32, Ping)
+	UE_TRACE_EVENT_FIELD(float, QualityLocal)
+	UE_TRACE_EVENT_FIELD(float, QualityRemote)
+	UE_TRACE_EVENT_FIELD(float, OutBytesPerSec)
+	UE_TRACE_EVENT_FIELD(float, InBytesPerSec)
+	UE_TRACE_EVENT_FIELD(int32, SendRateBytesPerSec)
+	UE_TRACE_EVENT_FIELD(int32, PendingUnreliable)
+	UE_TRACE_EVENT_FIELD(int32, PendingReliable)
+	UE_TRACE_EVENT_FIELD(int32, SentUnackedReliable)
+	UE_TRACE_EVENT_FIELD(int64, QueueTimeUsec)
+UE_TRACE_EVENT_END()
+
+// Lanes sampled per connection
+static constexpr int32 SteamCoreSocketsMaxSampledLanes = 8;
+
 static FString ConnectionStateToString(const ESteamNetworkingConnectionState& ConnectionState)
 {
 	switch (ConnectionState)
@@ -115,6 +164,8 @@ bool FSteamCoreSocketsSubsystem::Init(FString& Error)
 		GConfig->GetBool(TEXT("OnlineSubsystemSteamCore"), TEXT("bAllowP2PPacketRelay"), m_bUseRelays, GEngineIni);
 	}
 
+	GConfig->GetFloat(TEXT("OnlineSubsystemSteamCore"), TEXT("SocketStatsSampleInterval"), m_StatsSampleInterval, GEngineIni);
+
 #if !UE_BUILD_SHIPPING
 	bool bOverrideRelays = false;
 	if (FParse::Bool(FCommandLine::Get(), TEXT("SteamCoreSocketsRelays"), bOverrideRelays))
@@ -124,6 +175,30 @@ bool FSteamCoreSocketsSubsystem::Init(FString& Error)
 	}
 #endif
 
+	GConfig->GetBool(TEXT("OnlineSubsystemSteamCore"), TEXT("bUseLoopbackTransport"), m_bUseLoopbackTransport, GEngineIni);
+
+#if !UE_BUILD_SHIPPING
+	if (FParse::Param(FCommandLine::Get(), TEXT("SteamCoreSocketsLoopback")))
+	{
+		m_bUseLoopbackTransport = true;
+	}
+#endif
+
+	if (m_bUseLoopbackTransport)
+	{
+		FSteamCoreSocketsLoopbackSettings LoopbackSettings;
+		GConfig->GetFloat(TEXT("OnlineSubsystemSteamCore"), TEXT("LoopbackLatencyMs"), LoopbackSettings.LatencyMs, GEngineIni);
+		GConfig->GetFloat(TEXT("OnlineSubsystemSteamCore"), TEXT("LoopbackJitterMs"), LoopbackSettings.JitterMs, GEngineIni);
+		GConfig->GetFloat(TEXT("OnlineSubsystemSteamCore"), TEXT("LoopbackLossPercent"), LoopbackSettings.LossPercent, GEngineIni);
+		GConfig->GetFloat(TEXT("OnlineSubsystemSteamCore"), TEXT("LoopbackReorderPercent"), LoopbackSettings.ReorderPercent, GEngineIni);
+
+		// Everything stays in process, so there is no SteamAPI, relay network or login to wait for
+		UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Using the loopback transport"));
+		m_bUseRelays = false;
+		m_Transport = MakeShared<FSteamCoreSocketsLoopbackTransport, ESPMode::ThreadSafe>(LoopbackSettings);
+		return true;
+	}
+
 	FOnlineSubsystemSteamCore* OnlineSteamSubsystem = static_cast<FOnlineSubsystemSteamCore*>(IOnlineSubsystem::Get(STEAMCORE_SUBSYSTEM));
 
 	if (bIsDedicated)
@@ -187,6 +262,7 @@ bool FSteamCoreSocketsSubsystem::Init(FString& Error)
 	SteamNetworkingUtils()->SetDebugOutputFunction(DebugLevel, SteamCoreSocketsDebugLogger);
 
 	m_SteamEventManager = MakeUnique<FSteamCoreSocketsTaskManager>(this);
+	m_Transport = MakeShared<FSteamCoreSocketsSteamTransport, ESPMode::ThreadSafe>();
 
 	if (OnlineSteamSubsystem != nullptr && IsUsingRelayNetwork())
 	{
@@ -212,6 +288,9 @@ void FSteamCoreSocketsSubsystem::Shutdown()
 	}
 
 	m_PendingListenerArray.Empty();
+	m_Transport.Reset();
+	FSteamCoreSocketsMessagePool::Trim();
+	FSteamCoreSocketsLoopbackTransport::TrimMessagePool();
 	m_SteamAPIClientHandle.Reset();
 	m_SteamAPIServerHandle.Reset();
 }
@@ -413,28 +492,57 @@ TArray<TSharedRef<FInternetAddr>> FSteamCoreSocketsSubsystem::GetLocalBindAddres
 
 void FSteamCoreSocketsSubsystem::CleanSocketInformation(bool bForceClean)
 {
-	for (SocketHandleInfoMap::TIterator It(m_SocketInformationMap); It; ++It)
+	if (bForceClean)
 	{
-		FSteamCoreSocketInformation& SocketInfo = It.Value();
-		if (SocketInfo.IsMarkedForDeletion() || bForceClean)
+		for (SocketHandleInfoMap::TIterator It(m_SocketInformationMap); It; ++It)
 		{
-			USteamCoreSocketsNetDriver* NetDriverInfo = SocketInfo.m_NetDriver.Get();
-			if (NetDriverInfo && SocketInfo.m_Parent == nullptr)
-			{
-				NetDriverInfo->Shutdown();
-				SocketInfo.m_NetDriver.Reset();
-			}
+			It.Value().MarkForDeletion();
+		}
+	}
 
-			if (SocketInfo.m_Socket)
-			{
-				DestroySocket(SocketInfo.m_Socket);
-			}
+	// Tearing a socket down can mark more entries, those are pushed to the head and handled in this same pass
+	while (m_PendingDeletionHead != k_HSteamNetConnection_Invalid)
+	{
+		const SteamCoreSocketHandles SocketHandle = m_PendingDeletionHead;
+		FSteamCoreSocketInformation* SocketInfo = m_SocketInformationMap.Find(SocketHandle);
+		if (SocketInfo == nullptr)
+		{
+			UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Pending deletion list points at untracked socket %u, dropping the rest of the list"), SocketHandle);
+			m_PendingDeletionHead = k_HSteamNetConnection_Invalid;
+			break;
+		}
+		m_PendingDeletionHead = SocketInfo->m_NextPendingDeletion;
 
-			It.RemoveCurrent();
+		USteamCoreSocketsNetDriver* NetDriverInfo = SocketInfo->m_NetDriver.Get();
+		if (NetDriverInfo && SocketInfo->m_Parent == nullptr)
+		{
+			NetDriverInfo->Shutdown();
+			SocketInfo->m_NetDriver.Reset();
+		}
+
+		if (SocketInfo->m_Socket)
+		{
+			DestroySocket(SocketInfo->m_Socket);
+		}
+
+		if (SocketInfo->m_ParentHandle != k_HSteamNetConnection_Invalid)
+		{
+			m_SocketChildren.RemoveSingle(SocketInfo->m_ParentHandle, SocketHandle);
 		}
+		m_SocketChildren.Remove(SocketHandle);
+
+		UnindexSocketAddress(SocketHandle, *SocketInfo);
+		m_ConnectionStats.Remove(SocketHandle);
+		m_SocketInformationMap.Remove(SocketHandle);
 	}
 }
 
+void FSteamCoreSocketsSubsystem::QueuePendingDeletion(FSteamCoreSocketInformation& SocketInfo)
+{
+	SocketInfo.m_NextPendingDeletion = m_PendingDeletionHead;
+	m_PendingDeletionHead = SocketInfo.m_Handle;
+}
+
 void FSteamCoreSocketsSubsystem::DumpSocketInformationMap() const
 {
 #if !UE_BUILD_SHIPPING
@@ -462,10 +570,168 @@ bool FSteamCoreSocketsSubsystem::Tick(float DeltaTime)
 		m_SteamEventManager->Tick();
 	}
 
+	if (m_Transport.IsValid())
+	{
+		m_Transport->DispatchStatusEvents(*this);
+	}
+
 	CleanSocketInformation(false);
+	SampleConnectionStats();
+	PublishConnectionStats();
 	return true;
 }
 
+void FSteamCoreSocketsSubsystem::SampleConnectionStats()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (m_StatsSampleInterval <= 0.0f || Now - m_LastStatsSampleTime < m_StatsSampleInterval)
+	{
+		return;
+	}
+	m_LastStatsSampleTime = Now;
+
+	ISteamCoreSocketsTransport* Transport = GetTransport();
+	if (Transport == nullptr)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FSteamCoreSocketsSubsystem_SampleConnectionStats);
+
+	FSteamCoreSocketAggregateStats Aggregate;
+	int64 TotalPing = 0;
+
+	for (SocketHandleInfoMap::TConstIterator It(m_SocketInformationMap); It; ++It)
+	{
+		const FSteamCoreSocketInformation& SocketInfo = It.Value();
+		if (SocketInfo.IsMarkedForDeletion() || SocketInfo.m_Socket == nullptr || SocketInfo.m_Socket->m_bIsListenSocket)
+		{
+			continue;
+		}
+
+		SteamNetConnectionRealTimeStatus_t Status;
+		SteamNetConnectionRealTimeLaneStatus_t LaneStatus[SteamCoreSocketsMaxSampledLanes];
+		const int32 NumLanes = FMath::Clamp(SocketInfo.m_Socket->m_NumLanes, 1, SteamCoreSocketsMaxSampledLanes);
+		if (Transport->GetConnectionRealTimeStatus(It.Key(), &Status, NumLanes, LaneStatus) != k_EResultOK || Status.m_eState != k_ESteamNetworkingConnectionState_Connected)
+		{
+			m_ConnectionStats.Remove(It.Key());
+			continue;
+		}
+
+		FSteamCoreSocketConnectionStats& Stats = m_ConnectionStats.FindOrAdd(It.Key());
+		if (Stats.Address.IsEmpty() && SocketInfo.m_Addr.IsValid())
+		{
+			Stats.Address = SocketInfo.m_Addr->ToString(true);
+		}
+		Stats.Ping = Status.m_nPing;
+		Stats.QualityLocal = Status.m_flConnectionQualityLocal;
+		Stats.QualityRemote = Status.m_flConnectionQualityRemote;
+		Stats.OutPacketsPerSec = Status.m_flOutPacketsPerSec;
+		Stats.OutBytesPerSec = Status.m_flOutBytesPerSec;
+		Stats.InPacketsPerSec = Status.m_flInPacketsPerSec;
+		Stats.InBytesPerSec = Status.m_flInBytesPerSec;
+		Stats.SendRateBytesPerSec = Status.m_nSendRateBytesPerSecond;
+		Stats.PendingUnreliable = Status.m_cbPendingUnreliable;
+		Stats.PendingReliable = Status.m_cbPendingReliable;
+		Stats.SentUnackedReliable = Status.m_cbSentUnackedReliable;
+		Stats.QueueTimeUsec = Status.m_usecQueueTime;
+		Stats.SampleTime = Now;
+
+		Stats.Lanes.SetNum(NumLanes);
+		for (int32 LaneIdx = 0; LaneIdx < NumLanes; ++LaneIdx)
+		{
+			Stats.Lanes[LaneIdx].PendingUnreliable = LaneStatus[LaneIdx].m_cbPendingUnreliable;
+			Stats.Lanes[LaneIdx].PendingReliable = LaneStatus[LaneIdx].m_cbPendingReliable;
+			Stats.Lanes[LaneIdx].SentUnackedReliable = LaneStatus[LaneIdx].m_cbSentUnackedReliable;
+			Stats.Lanes[LaneIdx].QueueTimeUsec = LaneStatus[LaneIdx].m_usecQueueTime;
+			if (LaneIdx < (int32)ESteamCoreSocketsTrafficClass::Count)
+			{
+				Stats.Lanes[LaneIdx].BytesSent = SocketInfo.m_Socket->m_LaneBytesSent[LaneIdx];
+				Stats.Lanes[LaneIdx].PacketsSent = SocketInfo.m_Socket->m_LanePacketsSent[LaneIdx];
+			}
+		}
+
+		Aggregate.NumConnections++;
+		Aggregate.MaxPing = FMath::Max(Aggregate.MaxPing, Stats.Ping);
+		Aggregate.MinQuality = FMath::Min(Aggregate.MinQuality, Stats.QualityLocal);
+		Aggregate.OutBytesPerSec += Stats.OutBytesPerSec;
+		Aggregate.InBytesPerSec += Stats.InBytesPerSec;
+		Aggregate.PendingUnreliable += Stats.PendingUnreliable;
+		Aggregate.PendingReliable += Stats.PendingReliable;
+		Aggregate.SentUnackedReliable += Stats.SentUnackedReliable;
+		Aggregate.MaxQueueTimeUsec = FMath::Max(Aggregate.MaxQueueTimeUsec, Stats.QueueTimeUsec);
+		TotalPing += Stats.Ping;
+
+		UE_TRACE_LOG(SteamCoreSockets, ConnectionStats, SteamCoreSocketsChannel)
+			<< ConnectionStats.Cycle(FPlatformTime::Cycles64())
+			<< ConnectionStats.Handle(It.Key())
+			<< ConnectionStats.Ping(Stats.Ping)
+			<< ConnectionStats.QualityLocal(Stats.QualityLocal)
+			<< ConnectionStats.QualityRemote(Stats.QualityRemote)
+			<< ConnectionStats.OutBytesPerSec(Stats.OutBytesPerSec)
+			<< ConnectionStats.InBytesPerSec(Stats.InBytesPerSec)
+			<< ConnectionStats.SendRateBytesPerSec(Stats.SendRateBytesPerSec)
+			<< ConnectionStats.PendingUnreliable(Stats.PendingUnreliable)
+			<< ConnectionStats.PendingReliable(Stats.PendingReliable)
+			<< ConnectionStats.SentUnackedReliable(Stats.SentUnackedReliable)
+			<< ConnectionStats.QueueTimeUsec(Stats.QueueTimeUsec);
+	}
+
+	if (Aggregate.NumConnections > 0)
+	{
+		Aggregate.AveragePing = (float)TotalPing / Aggregate.NumConnections;
+	}
+	m_AggregateStats = Aggregate;
+}
+
+void FSteamCoreSocketsSubsystem::PublishConnectionStats() const
+{
+	// Published every tick from the last sample so stat and csv captures line up with frames
+	SET_DWORD_STAT(STAT_SteamCoreSockets_Connections, m_AggregateStats.NumConnections);
+	SET_DWORD_STAT(STAT_SteamCoreSockets_MaxPing, m_AggregateStats.MaxPing);
+	SET_FLOAT_STAT(STAT_SteamCoreSockets_AveragePing, m_AggregateStats.AveragePing);
+	SET_FLOAT_STAT(STAT_SteamCoreSockets_MinQuality, m_AggregateStats.MinQuality);
+	SET_FLOAT_STAT(STAT_SteamCoreSockets_OutBytesPerSec, m_AggregateStats.OutBytesPerSec);
+	SET_FLOAT_STAT(STAT_SteamCoreSockets_InBytesPerSec, m_AggregateStats.InBytesPerSec);
+	SET_DWORD_STAT(STAT_SteamCoreSockets_PendingUnreliable, m_AggregateStats.PendingUnreliable);
+	SET_DWORD_STAT(STAT_SteamCoreSockets_PendingReliable, m_AggregateStats.PendingReliable);
+	SET_DWORD_STAT(STAT_SteamCoreSockets_SentUnackedReliable, m_AggregateStats.SentUnackedReliable);
+	SET_FLOAT_STAT(STAT_SteamCoreSockets_MaxQueueTime, m_AggregateStats.MaxQueueTimeUsec / 1000.0f);
+
+	CSV_CUSTOM_STAT(SteamCoreSockets, Connections, m_AggregateStats.NumConnections, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, MaxPing, m_AggregateStats.MaxPing, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, AveragePing, m_AggregateStats.AveragePing, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, MinQuality, m_AggregateStats.MinQuality, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, OutKBytesPerSec, m_AggregateStats.OutBytesPerSec / 1024.0f, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, InKBytesPerSec, m_AggregateStats.InBytesPerSec / 1024.0f, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, PendingReliableBytes, m_AggregateStats.PendingReliable, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, PendingUnreliableBytes, m_AggregateStats.PendingUnreliable, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SteamCoreSockets, MaxQueueTimeMs, m_AggregateStats.MaxQueueTimeUsec / 1000.0f, ECsvCustomStatOp::Set);
+
+	TRACE_COUNTER_SET(SteamCoreSockets_Connections, m_AggregateStats.NumConnections);
+	TRACE_COUNTER_SET(SteamCoreSockets_MaxPing, m_AggregateStats.MaxPing);
+	TRACE_COUNTER_SET(SteamCoreSockets_MinQuality, m_AggregateStats.MinQuality);
+	TRACE_COUNTER_SET(SteamCoreSockets_PendingReliable, m_AggregateStats.PendingReliable);
+	TRACE_COUNTER_SET(SteamCoreSockets_PendingUnreliable, m_AggregateStats.PendingUnreliable);
+}
+
+void FSteamCoreSocketsSubsystem::DumpConnectionStats() const
+{
+#if !UE_BUILD_SHIPPING
+	if (m_ConnectionStats.Num() < 1)
+	{
+		UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: No connection stats sampled (interval %.2fs)"), m_StatsSampleInterval);
+		return;
+	}
+
+	UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Printing Connection Stats for %d connections, max ping %d, min quality %.3f:\n"), m_AggregateStats.NumConnections, m_AggregateStats.MaxPing, m_AggregateStats.MinQuality);
+	for (const TPair<SteamCoreSocketHandles, FSteamCoreSocketConnectionStats>& Pair : m_ConnectionStats)
+	{
+		UE_LOG(LogSockets, Log, TEXT("# Handle[%u] %s"), Pair.Key, *Pair.Value.ToString());
+	}
+#endif
+}
+
 bool FSteamCoreSocketsSubsystem::Exec(class UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar)
 {
 	bool bIsHandled = false;
@@ -485,6 +751,11 @@ bool FSteamCoreSocketsSubsystem::Exec(class UWorld* InWorld, const TCHAR* Cmd, F
 			UE_LOG(LogSockets, Log, TEXT("# %s"), *Pending.ToString());
 		}
 	}
+	else if (FParse::Command(&Cmd, TEXT("PrintSteamSocketStats")))
+	{
+		bIsHandled = true;
+		DumpConnectionStats();
+	}
 	else if (FParse::Command(&Cmd, TEXT("ClearSteamSocketInfo")))
 	{
 		UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Clearing all socket information!"));
@@ -497,16 +768,98 @@ bool FSteamCoreSocketsSubsystem::Exec(class UWorld* InWorld, const TCHAR* Cmd, F
 		m_bShouldTestPeek = !m_bShouldTestPeek;
 		UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Set Peek Messaging to %d"), m_bShouldTestPeek);
 	}
+	else if (FParse::Command(&Cmd, TEXT("SteamSocketsBenchmark")))
+	{
+		bIsHandled = true;
+		RunBenchmark(Cmd);
+	}
 #endif
 
 	return bIsHandled;
 }
 
+#if !UE_BUILD_SHIPPING
+void FSteamCoreSocketsSubsystem::RunBenchmark(const TCHAR* Cmd)
+{
+	// SteamSocketsBenchmark Clients=16 Frames=600 FrameMs=16.67 Latency=0 Jitter=0 Loss=0 Reorder=0 Mix=64:30,960:5 Out=<path>
+	FSteamCoreSocketsBenchmarkSettings Settings;
+	FParse::Value(Cmd, TEXT("Clients="), Settings.NumClients);
+	FParse::Value(Cmd, TEXT("Frames="), Settings.NumFrames);
+	FParse::Value(Cmd, TEXT("Warmup="), Settings.WarmupFrames);
+	FParse::Value(Cmd, TEXT("FrameMs="), Settings.FrameTimeMs);
+	FParse::Value(Cmd, TEXT("Latency="), Settings.Transport.LatencyMs);
+	FParse::Value(Cmd, TEXT("Jitter="), Settings.Transport.JitterMs);
+	FParse::Value(Cmd, TEXT("Loss="), Settings.Transport.LossPercent);
+	FParse::Value(Cmd, TEXT("Reorder="), Settings.Transport.ReorderPercent);
+	FParse::Value(Cmd, TEXT("Seed="), Settings.Transport.Seed);
+
+	FString Mix;
+	if (FParse::Value(Cmd, TEXT("Mix="), Mix, false) && !Settings.ParseTrafficMix(Mix))
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Invalid benchmark mix '%s', expected Size:Rate entries separated by commas"), *Mix);
+		return;
+	}
+
+	UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Running socket benchmark with %d clients for %d frames"), Settings.NumClients, Settings.NumFrames);
+	const FSteamCoreSocketsBenchmarkResult Result = FSteamCoreSocketsBenchmark::Run(*this, Settings);
+	if (!Result.bCompleted)
+	{
+		return;
+	}
+
+	const FString Json = Result.ToJson();
+	UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Benchmark %s"), *Result.ToString());
+	UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Benchmark json %s"), *Json);
+
+	FString OutPath;
+	if (!FParse::Value(Cmd, TEXT("Out="), OutPath))
+	{
+		OutPath = FPaths::ProfilingDir() / TEXT("SteamCoreSockets") / FString::Printf(TEXT("Benchmark-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	if (FFileHelper::SaveStringToFile(Json, *OutPath))
+	{
+		UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Benchmark written to %s"), *OutPath);
+	}
+	else
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Could not write benchmark to %s"), *OutPath);
+	}
+}
+#endif
+
 ISteamNetworkingSockets* FSteamCoreSocketsSubsystem::GetSteamSocketsInterface()
 {
 	return (SteamGameServerNetworkingSockets() != nullptr && IsRunningDedicatedServer()) ? SteamGameServerNetworkingSockets() : SteamNetworkingSockets();
 }
 
+ISteamCoreSocketsTransport* FSteamCoreSocketsSubsystem::GetTransport()
+{
+	return m_SocketSingleton ? m_SocketSingleton->m_Transport.Get() : nullptr;
+}
+
+bool FSteamCoreSocketsSubsystem::SetTransport(TSharedPtr<ISteamCoreSocketsTransport, ESPMode::ThreadSafe> NewTransport)
+{
+	if (!NewTransport.IsValid())
+	{
+		return false;
+	}
+
+	if (m_SocketInformationMap.Num() > 0 || m_PendingListenerArray.Num() > 0)
+	{
+		UE_LOG(LogSockets, Warning, TEXT("SteamCoreSockets: Cannot swap the transport while sockets are open"));
+		return false;
+	}
+
+	m_Transport = NewTransport;
+	m_bUseLoopbackTransport = m_Transport->IsLoopback();
+	if (m_bUseLoopbackTransport)
+	{
+		m_bUseRelays = false;
+	}
+	return true;
+}
+
 bool FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation::operator==(const FInternetAddr& InAddr) const
 {
 	const FInternetAddrSteamCoreSockets SteamAddr = *((FInternetAddrSteamCoreSockets*)&InAddr);
@@ -515,7 +868,17 @@ bool FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation::operator==(const F
 
 void FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation::MarkForDeletion()
 {
+	if (m_bMarkedForDeletion)
+	{
+		return;
+	}
+
 	m_bMarkedForDeletion = true;
+	if (m_SocketSingleton != nullptr)
+	{
+		m_SocketSingleton->QueuePendingDeletion(*this);
+	}
+
 	const USteamCoreSocketsNetDriver* NetDriverObj = m_NetDriver.Get();
 	if (m_Socket != nullptr && NetDriverObj)
 	{
@@ -529,6 +892,18 @@ FString FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation::ToString() cons
 	return FString::Printf(TEXT("SocketInfo: Addr[%s], Socket[%u], Status[%d], Listener[%d], HasNetDriver[%d], MarkedForDeletion[%d]"), (m_Addr.IsValid() ? *m_Addr->ToString(true) : TEXT("INVALID")), (m_Socket != nullptr ? m_Socket->m_InternalHandle : 0), (m_Socket != nullptr ? (int32)m_Socket->GetConnectionState() : -1), (m_Parent != nullptr), m_NetDriver.IsValid(), m_bMarkedForDeletion);
 }
 
+FString FSteamCoreSocketsSubsystem::FSteamCoreSocketConnectionStats::ToString() const
+{
+	FString Result = FString::Printf(TEXT("ConnectionStats: Addr[%s], Ping[%d], Quality[%.3f/%.3f], Out[%.1f pkt/s %.0f B/s], In[%.1f pkt/s %.0f B/s], SendRate[%d B/s], Pending[%d unreliable %d reliable], Unacked[%d], QueueTime[%lld us]"),
+		*Address, Ping, QualityLocal, QualityRemote, OutPacketsPerSec, OutBytesPerSec, InPacketsPerSec, InBytesPerSec, SendRateBytesPerSec, PendingUnreliable, PendingReliable, SentUnackedReliable, QueueTimeUsec);
+	for (int32 LaneIdx = 0; LaneIdx < Lanes.Num(); ++LaneIdx)
+	{
+		const FSteamCoreSocketLaneStats& Lane = Lanes[LaneIdx];
+		Result += FString::Printf(TEXT(", Lane%d[%d unreliable %d reliable %d unacked %lld us, sent %lld pkt %lld B]"), LaneIdx, Lane.PendingUnreliable, Lane.PendingReliable, Lane.SentUnackedReliable, Lane.QueueTimeUsec, Lane.PacketsSent, Lane.BytesSent);
+	}
+	return Result;
+}
+
 FString FSteamCoreSocketsSubsystem::FSteamPendingSocketInformation::ToString() const
 {
 	const USteamCoreSocketsNetDriver* SteamNetDriver = NetDriver.Get();
@@ -553,17 +928,34 @@ FSteamCoreSocketsSubsystem::FSteamCoreSocketInformation* FSteamCoreSocketsSubsys
 		return nullptr;
 	}
 
-	for (SocketHandleInfoMap::TIterator It(m_SocketInformationMap); It; ++It)
+	for (TMultiMap<uint32, SteamCoreSocketHandles>::TConstKeyIterator It(m_SocketAddressIndex, ForAddress.GetTypeHash()); It; ++It)
 	{
-		if (It.Value() == ForAddress)
+		FSteamCoreSocketInformation* SocketInfo = m_SocketInformationMap.Find(It.Value());
+		if (SocketInfo != nullptr && !SocketInfo->IsMarkedForDeletion() && *SocketInfo == ForAddress)
 		{
-			return &(It.Value());
+			return SocketInfo;
 		}
 	}
 
 	return nullptr;
 }
 
+void FSteamCoreSocketsSubsystem::IndexSocketAddress(SteamCoreSocketHandles SocketHandle, const FSteamCoreSocketInformation& SocketInfo)
+{
+	if (SocketInfo.m_Addr.IsValid())
+	{
+		m_SocketAddressIndex.AddUnique(SocketInfo.m_Addr->GetTypeHash(), SocketHandle);
+	}
+}
+
+void FSteamCoreSocketsSubsystem::UnindexSocketAddress(SteamCoreSocketHandles SocketHandle, const FSteamCoreSocketInformation& SocketInfo)
+{
+	if (SocketInfo.m_Addr.IsValid())
+	{
+		m_SocketAddressIndex.RemoveSingle(SocketInfo.m_Addr->GetTypeHash(), SocketHandle);
+	}
+}
+
 void FSteamCoreSocketsSubsystem::AddSocket(const FInternetAddr& ForAddr, FSteamCoreSocket* NewSocket, FSteamCoreSocket* ParentSocket)
 {
 	if (NewSocket == nullptr || ForAddr.IsValid() == false)
@@ -580,11 +972,17 @@ void FSteamCoreSocketsSubsystem::AddSocket(const FInternetAddr& ForAddr, FSteamC
 	}
 	STEAM_SDK_IGNORE_REDUNDANCY_END
 
-	const FSteamCoreSocketInformation NewSocketInfo(ForAddr.Clone(), NewSocket, ParentSocket);
+	const SteamCoreSocketHandles ParentHandle = (ParentSocket != nullptr) ? ParentSocket->m_InternalHandle : k_HSteamNetConnection_Invalid;
+	const FSteamCoreSocketInformation NewSocketInfo(NewSocket->m_InternalHandle, ForAddr.Clone(), NewSocket, ParentSocket, ParentHandle);
 	if (m_SocketInformationMap.Find(NewSocket->m_InternalHandle) == nullptr)
 	{
 		UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Now tracking socket %u for addr %s, has parent? %d"), NewSocket->m_InternalHandle, *ForAddr.ToString(true), (ParentSocket != nullptr));
 		m_SocketInformationMap.Add(NewSocket->m_InternalHandle, NewSocketInfo);
+		IndexSocketAddress(NewSocket->m_InternalHandle, NewSocketInfo);
+		if (ParentHandle != k_HSteamNetConnection_Invalid)
+		{
+			m_SocketChildren.Add(ParentHandle, NewSocket->m_InternalHandle);
+		}
 	}
 	else
 	{
@@ -601,15 +999,22 @@ void FSteamCoreSocketsSubsystem::RemoveSocketsForListener(FSteamCoreSocket* List
 	}
 
 	UE_LOG(LogSockets, Log, TEXT("SteamCoreSockets: Closing all sockets attached to listener %u"), ListenerSocket->m_InternalHandle);
-	for (SocketHandleInfoMap::TIterator It(m_SocketInformationMap); It; ++It)
+
+	TArray<SteamCoreSocketHandles, TInlineAllocator<32>> ChildHandles;
+	m_SocketChildren.MultiFind(ListenerSocket->m_InternalHandle, ChildHandles);
+	m_SocketChildren.Remove(ListenerSocket->m_InternalHandle);
+
+	for (const SteamCoreSocketHandles ChildHandle : ChildHandles)
 	{
-		FSteamCoreSocketInformation& SocketInfo = It.Value();
-		if (SocketInfo.m_Parent == ListenerSocket)
+		FSteamCoreSocketInformation* SocketInfo = m_SocketInformationMap.Find(ChildHandle);
+		if (SocketInfo != nullptr && SocketInfo->m_Parent == ListenerSocket)
 		{
-			UE_LOG(LogSockets, Verbose, TEXT("SteamCoreSockets: Removed socket %u"), SocketInfo.m_Socket->m_InternalHandle);
-			SocketInfo.m_Parent = nullptr;
-			SocketInfo.m_NetDriver.Reset();
-			SocketInfo.MarkForDeletion();
+			UE_LOG(LogSockets, Verbose, TEXT("SteamCoreSockets: Removed socket %u"), ChildHandle);
+			SocketInfo->m_Parent = nullptr;
+			SocketInfo->m_ParentHandle = k_HSteamNetConnection_Invalid;
+			SocketInfo->m_NetDriver.Reset();
+			SocketInfo->MarkForDeletion();
+			UnindexSocketAddress(ChildHandle, *SocketInfo);
 		}
 	}
 }
@@ -622,6 +1027,7 @@ void FSteamCoreSocketsSubsystem::QueueRemoval(SteamCoreSocketHandles RemoveHandl
 		FString Address = (SocketInfo->m_Addr.IsValid()) ? SocketInfo->m_Addr->ToString(true) : TEXT("INVALID");
 		UE_LOG(LogSockets, Verbose, TEXT("SteamCoreSockets: Marked socket %u with address %s for removal (pending)"), RemoveHandle, *Address);
 		SocketInfo->MarkForDeletion();
+		UnindexSocketAddress(RemoveHandle, *SocketInfo);
 	}
 }
 
@@ -738,7 +1144,7 @@ bool FSteamCoreSocketsSubsystem::IsLoggedInToSteam() const
 
 void FSteamCoreSocketsSubsystem::SteamCoreSocketEventHandler(struct SteamNetConnectionStatusChangedCallback_t* Message)
 {
-	if (Message == nullptr || FSteamCoreSocketsSubsystem::GetSteamSocketsInterface() == nullptr)
+	if (Message == nullptr || FSteamCoreSocketsSubsystem::GetTransport() == nullptr)
 	{
 		return;
 	}
@@ -0,0 +1,129 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#include "SteamCoreSocketsTransport.h"
+#include "SteamCoreSocketsSubsystem.h"
+
+#if WITH_STEAMCORE
+HSteamListenSocket FSteamCoreSocketsSteamTransport::CreateListenSocketIP(const SteamNetworkingIPAddr& LocalAddress, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->CreateListenSocketIP(LocalAddress, NumOptions, Options) : k_HSteamListenSocket_Invalid;
+}
+
+HSteamListenSocket FSteamCoreSocketsSteamTransport::CreateListenSocketP2P(int32 LocalVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->CreateListenSocketP2P(LocalVirtualPort, NumOptions, Options) : k_HSteamListenSocket_Invalid;
+}
+
+HSteamNetConnection FSteamCoreSocketsSteamTransport::ConnectByIPAddress(const SteamNetworkingIPAddr& Address, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->ConnectByIPAddress(Address, NumOptions, Options) : k_HSteamNetConnection_Invalid;
+}
+
+HSteamNetConnection FSteamCoreSocketsSteamTransport::ConnectP2P(const SteamNetworkingIdentity& RemoteIdentity, int32 RemoteVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->ConnectP2P(RemoteIdentity, RemoteVirtualPort, NumOptions, Options) : k_HSteamNetConnection_Invalid;
+}
+
+EResult FSteamCoreSocketsSteamTransport::AcceptConnection(HSteamNetConnection Connection)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->AcceptConnection(Connection) : k_EResultServiceUnavailable;
+}
+
+bool FSteamCoreSocketsSteamTransport::CloseConnection(HSteamNetConnection Connection, int32 Reason, const char* Debug, bool bEnableLinger)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->CloseConnection(Connection, Reason, Debug, bEnableLinger) : false;
+}
+
+bool FSteamCoreSocketsSteamTransport::CloseListenSocket(HSteamListenSocket ListenSocket)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->CloseListenSocket(ListenSocket) : false;
+}
+
+HSteamNetPollGroup FSteamCoreSocketsSteamTransport::CreatePollGroup()
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->CreatePollGroup() : k_HSteamNetPollGroup_Invalid;
+}
+
+bool FSteamCoreSocketsSteamTransport::DestroyPollGroup(HSteamNetPollGroup PollGroup)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->DestroyPollGroup(PollGroup) : false;
+}
+
+bool FSteamCoreSocketsSteamTransport::SetConnectionPollGroup(HSteamNetConnection Connection, HSteamNetPollGroup PollGroup)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->SetConnectionPollGroup(Connection, PollGroup) : false;
+}
+
+EResult FSteamCoreSocketsSteamTransport::SendMessageToConnection(HSteamNetConnection Connection, const void* Data, uint32 Size, int32 SendFlags, int64* OutMessageNumber)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->SendMessageToConnection(Connection, Data, Size, SendFlags, OutMessageNumber) : k_EResultServiceUnavailable;
+}
+
+void FSteamCoreSocketsSteamTransport::SendMessages(int32 NumMessages, SteamNetworkingMessage_t* const* Messages, int64* OutMessageNumberOrResult)
+{
+	if (ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface())
+	{
+		SocketInterface->SendMessages(NumMessages, Messages, OutMessageNumberOrResult);
+		return;
+	}
+
+	// Ownership passes to the transport either way
+	for (int32 MessageIdx = 0; MessageIdx < NumMessages; ++MessageIdx)
+	{
+		Messages[MessageIdx]->Release();
+		if (OutMessageNumberOrResult != nullptr)
+		{
+			OutMessageNumberOrResult[MessageIdx] = -k_EResultServiceUnavailable;
+		}
+	}
+}
+
+int32 FSteamCoreSocketsSteamTransport::ReceiveMessagesOnConnection(HSteamNetConnection Connection, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->ReceiveMessagesOnConnection(Connection, OutMessages, MaxMessages) : -1;
+}
+
+int32 FSteamCoreSocketsSteamTransport::ReceiveMessagesOnPollGroup(HSteamNetPollGroup PollGroup, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->ReceiveMessagesOnPollGroup(PollGroup, OutMessages, MaxMessages) : -1;
+}
+
+bool FSteamCoreSocketsSteamTransport::GetConnectionInfo(HSteamNetConnection Connection, SteamNetConnectionInfo_t* OutInfo)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->GetConnectionInfo(Connection, OutInfo) : false;
+}
+
+EResult FSteamCoreSocketsSteamTransport::GetConnectionRealTimeStatus(HSteamNetConnection Connection, SteamNetConnectionRealTimeStatus_t* OutStatus, int32 NumLanes, SteamNetConnectionRealTimeLaneStatus_t* OutLanes)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->GetConnectionRealTimeStatus(Connection, OutStatus, NumLanes, OutLanes) : k_EResultServiceUnavailable;
+}
+
+EResult FSteamCoreSocketsSteamTransport::ConfigureConnectionLanes(HSteamNetConnection Connection, int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights)
+{
+	ISteamNetworkingSockets* SocketInterface = FSteamCoreSocketsSubsystem::GetSteamSocketsInterface();
+	return SocketInterface ? SocketInterface->ConfigureConnectionLanes(Connection, NumLanes, LanePriorities, LaneWeights) : k_EResultServiceUnavailable;
+}
+
+SteamNetworkingMessage_t* FSteamCoreSocketsSteamTransport::AllocateMessage(int32 BufferSize)
+{
+	return SteamNetworkingUtils() ? SteamNetworkingUtils()->AllocateMessage(BufferSize) : nullptr;
+}
+#endif
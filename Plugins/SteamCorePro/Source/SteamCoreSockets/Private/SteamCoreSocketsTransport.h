@@ -0,0 +1,80 @@
+/**
+* Copyright (C) 2017-2024 eelDev AB
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamCoreSocketsPrivate.h"
+
+class FSteamCoreSocketsSubsystem;
+
+#if WITH_STEAMCORE
+/**
+* The part of ISteamNetworkingSockets the socket layer relies on.
+* FSteamCoreSocket, the net driver and the network thread only talk to a transport, so the Steam implementation can be
+* swapped for an in-process one. Signatures and return values follow ISteamNetworkingSockets.
+*/
+class ISteamCoreSocketsTransport
+{
+public:
+	virtual ~ISteamCoreSocketsTransport() {}
+
+	virtual HSteamListenSocket CreateListenSocketIP(const SteamNetworkingIPAddr& LocalAddress, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) = 0;
+	virtual HSteamListenSocket CreateListenSocketP2P(int32 LocalVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) = 0;
+	virtual HSteamNetConnection ConnectByIPAddress(const SteamNetworkingIPAddr& Address, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) = 0;
+	virtual HSteamNetConnection ConnectP2P(const SteamNetworkingIdentity& RemoteIdentity, int32 RemoteVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) = 0;
+	virtual EResult AcceptConnection(HSteamNetConnection Connection) = 0;
+	virtual bool CloseConnection(HSteamNetConnection Connection, int32 Reason, const char* Debug, bool bEnableLinger) = 0;
+	virtual bool CloseListenSocket(HSteamListenSocket ListenSocket) = 0;
+
+	virtual HSteamNetPollGroup CreatePollGroup() = 0;
+	virtual bool DestroyPollGroup(HSteamNetPollGroup PollGroup) = 0;
+	virtual bool SetConnectionPollGroup(HSteamNetConnection Connection, HSteamNetPollGroup PollGroup) = 0;
+
+	virtual EResult SendMessageToConnection(HSteamNetConnection Connection, const void* Data, uint32 Size, int32 SendFlags, int64* OutMessageNumber) = 0;
+	virtual void SendMessages(int32 NumMessages, SteamNetworkingMessage_t* const* Messages, int64* OutMessageNumberOrResult) = 0;
+	virtual int32 ReceiveMessagesOnConnection(HSteamNetConnection Connection, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages) = 0;
+	virtual int32 ReceiveMessagesOnPollGroup(HSteamNetPollGroup PollGroup, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages) = 0;
+
+	virtual bool GetConnectionInfo(HSteamNetConnection Connection, SteamNetConnectionInfo_t* OutInfo) = 0;
+	virtual EResult GetConnectionRealTimeStatus(HSteamNetConnection Connection, SteamNetConnectionRealTimeStatus_t* OutStatus, int32 NumLanes, SteamNetConnectionRealTimeLaneStatus_t* OutLanes) = 0;
+	virtual EResult ConfigureConnectionLanes(HSteamNetConnection Connection, int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights) = 0;
+
+	/** Allocates a message the transport can send, with BufferSize bytes of payload when BufferSize is above 0 */
+	virtual SteamNetworkingMessage_t* AllocateMessage(int32 BufferSize) = 0;
+
+	/** Hands connection status changes raised by the transport itself to the subsystem. Steam posts its own through callbacks. */
+	virtual void DispatchStatusEvents(FSteamCoreSocketsSubsystem& Subsystem) = 0;
+
+	virtual bool IsLoopback() const { return false; }
+};
+
+/** Forwards to the client or game server ISteamNetworkingSockets */
+class FSteamCoreSocketsSteamTransport : public ISteamCoreSocketsTransport
+{
+public:
+	//~ Begin ISteamCoreSocketsTransport Interface
+	virtual HSteamListenSocket CreateListenSocketIP(const SteamNetworkingIPAddr& LocalAddress, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual HSteamListenSocket CreateListenSocketP2P(int32 LocalVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual HSteamNetConnection ConnectByIPAddress(const SteamNetworkingIPAddr& Address, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual HSteamNetConnection ConnectP2P(const SteamNetworkingIdentity& RemoteIdentity, int32 RemoteVirtualPort, int32 NumOptions, const SteamNetworkingConfigValue_t* Options) override;
+	virtual EResult AcceptConnection(HSteamNetConnection Connection) override;
+	virtual bool CloseConnection(HSteamNetConnection Connection, int32 Reason, const char* Debug, bool bEnableLinger) override;
+	virtual bool CloseListenSocket(HSteamListenSocket ListenSocket) override;
+	virtual HSteamNetPollGroup CreatePollGroup() override;
+	virtual bool DestroyPollGroup(HSteamNetPollGroup PollGroup) override;
+	virtual bool SetConnectionPollGroup(HSteamNetConnection Connection, HSteamNetPollGroup PollGroup) override;
+	virtual EResult SendMessageToConnection(HSteamNetConnection Connection, const void* Data, uint32 Size, int32 SendFlags, int64* OutMessageNumber) override;
+	virtual void SendMessages(int32 NumMessages, SteamNetworkingMessage_t* const* Messages, int64* OutMessageNumberOrResult) override;
+	virtual int32 ReceiveMessagesOnConnection(HSteamNetConnection Connection, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages) override;
+	virtual int32 ReceiveMessagesOnPollGroup(HSteamNetPollGroup PollGroup, SteamNetworkingMessage_t** OutMessages, int32 MaxMessages) override;
+	virtual bool GetConnectionInfo(HSteamNetConnection Connection, SteamNetConnectionInfo_t* OutInfo) override;
+	virtual EResult GetConnectionRealTimeStatus(HSteamNetConnection Connection, SteamNetConnectionRealTimeStatus_t* OutStatus, int32 NumLanes, SteamNetConnectionRealTimeLaneStatus_t* OutLanes) override;
+	virtual EResult ConfigureConnectionLanes(HSteamNetConnection Connection, int32 NumLanes, const int32* LanePriorities, const uint16* LaneWeights) override;
+	virtual SteamNetworkingMessage_t* AllocateMessage(int32 BufferSize) override;
+	virtual void DispatchStatusEvents(FSteamCoreSocketsSubsystem& Subsystem) override {}
+	//~ End ISteamCoreSocketsTransport Interface
+};
+#endif
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Engine/NetConnection.h"
+#include "SteamCoreSocketsTypes.h"
 #include "SteamCoreSocketsNetConnection.generated.h"
 
 class FSocket;
@@ -21,7 +22,8 @@ class STEAMCORESOCKETS_API USteamCoreSocketsNetConnection : public UNetConnectio
 public:
 	USteamCoreSocketsNetConnection() :
 		m_ConnectionSocket(nullptr),
-		m_bInConnectionlessHandshake(false)
+		m_bInConnectionlessHandshake(false),
+		m_PacketTrafficClass(ESteamCoreSocketsTrafficClass::Gameplay)
 	{
 	}
 
@@ -32,6 +34,8 @@ public:
 		EConnectionState InState, int32 InMaxPacket = 0, int32 InPacketOverhead = 0) override;
 	virtual void InitLocalConnection(UNetDriver* InDriver, FSocket* InSocket, const FURL& InURL, EConnectionState InState, int32 InMaxPacket = 0, int32 InPacketOverhead = 0) override;
 	virtual void LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
+	virtual int32 SendRawBunch(FOutBunch& Bunch, bool InAllowMerge, const FNetTraceCollector* BunchCollector) override;
+	using UNetConnection::SendRawBunch;
 	FString LowLevelGetRemoteAddress(bool bAppendPort=false) override;
 	FString LowLevelDescribe() override;
 	//~ End NetConnection Interface
@@ -42,8 +46,24 @@ private:
 	void FlagForHandshake() { m_bInConnectionlessHandshake = true; }
 	void ClearSocket() { m_ConnectionSocket = nullptr; }
 
+	/** Traffic class a bunch is sent as when the connection has lanes */
+	static ESteamCoreSocketsTrafficClass ClassifyBunch(const FOutBunch& Bunch);
+
+	/**
+	* Picks and records the lane for the packet being sent, lane 0 until the PacketHandler handshake is done.
+	* Packets share one sequence, so a packet only takes its own lane while the receiver's packet order correction can absorb the overtaking.
+	*/
+	uint16 SelectPacketLane();
+
 	FSteamCoreSocket* m_ConnectionSocket;
 	bool m_bInConnectionlessHandshake;
 
+	// Traffic class of the bunches in the packet currently being built, packets never mix classes
+	ESteamCoreSocketsTrafficClass m_PacketTrafficClass;
+
+	// Per lane, the newest packet sent on it and the first one sent since the lane last had nothing in flight
+	int32 m_LaneNewestPacketId[(int32)ESteamCoreSocketsTrafficClass::Count];
+	int32 m_LaneOldestPendingPacketId[(int32)ESteamCoreSocketsTrafficClass::Count];
+
 	friend class USteamCoreSocketsNetDriver;
 };
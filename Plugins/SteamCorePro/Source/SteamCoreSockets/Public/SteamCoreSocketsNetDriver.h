@@ -13,6 +13,7 @@
 #include "SteamCoreSocketsNetDriver.generated.h"
 
 class FNetworkNotify;
+struct SteamNetworkingMessage_t;
 
 UCLASS(transient, config=Engine)
 class STEAMCORESOCKETS_API USteamCoreSocketsNetDriver : public UNetDriver
@@ -21,8 +22,21 @@ class STEAMCORESOCKETS_API USteamCoreSocketsNetDriver : public UNetDriver
 
 public:
 	USteamCoreSocketsNetDriver() :
+		ReceiveBatchSize(128),
+		bBatchOutgoingMessages(true),
+		bUseNetworkThread(false),
+		NetworkThreadWaitMs(1),
+		bUseConnectionLanes(false),
+		LaneReorderWindow(8),
+		GameplayLanePriority(0),
+		VoiceLanePriority(10),
+		BulkLanePriority(10),
+		GameplayLaneWeight(1),
+		VoiceLaneWeight(3),
+		BulkLaneWeight(1),
 		m_Socket(nullptr),
-		m_bIsDelayedNetworkAccess(false)
+		m_bIsDelayedNetworkAccess(false),
+		m_bUsesPacketOrderCorrection(false)
 	{
 		RelevantTimeout = 5.0f;
 		KeepAliveTime = 0.2f;
@@ -48,20 +62,119 @@ public:
 	virtual bool InitConnect(FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error) override;
 	virtual bool InitListen(FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error) override;
 	virtual void TickDispatch(float DeltaTime) override;
+	virtual void TickFlush(float DeltaSeconds) override;
 	virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
 	virtual void LowLevelDestroy() override;
 	virtual class ISocketSubsystem* GetSocketSubsystem() override;
 	virtual bool IsNetResourceValid(void) override;
+	virtual void RemoveClientConnection(UNetConnection* ClientConnectionToRemove) override;
 	//~ End UNetDriver Interface
 
 	bool ArePacketHandlersDisabled() const;
 
+	/** Maximum number of messages pulled from the socket per receive call in TickDispatch, clamped to [1, 256] */
+	UPROPERTY(Config)
+	int32 ReceiveBatchSize;
+
+	/** Queues connection packets during the frame and sends them with a single SendMessages call at the end of TickFlush */
+	UPROPERTY(Config)
+	bool bBatchOutgoingMessages;
+
+	/** Receives and sends on a dedicated thread, TickDispatch then only drains what the thread queued. Sends need bBatchOutgoingMessages to leave the game thread. */
+	UPROPERTY(Config)
+	bool bUseNetworkThread;
+
+	/** Longest the network thread sleeps between receive polls when idle, in milliseconds */
+	UPROPERTY(Config)
+	int32 NetworkThreadWaitMs;
+
+	/**
+	* Sends gameplay, voice and bulk traffic on separate connection lanes so split reliable bunches do not delay RPCs.
+	* Packets on different lanes can overtake each other, so InitBase turns on the engine's packet order correction and lanes stay off if it cannot.
+	* The net.DoPacketOrderCorrection and net.PacketOrder* cvars are engine wide: every net driver in the process runs with the raised values
+	* until the last driver using lanes shuts down, which restores them. Steam does not negotiate lanes, so the peer must enable lanes as well,
+	* or at least packet order correction with the same LaneReorderWindow, to take our overtaking packets.
+	*/
+	UPROPERTY(Config)
+	bool bUseConnectionLanes;
+
+	/**
+	* Most unacknowledged packets a packet may overtake by changing lanes, both sides must use the same value.
+	* net.PacketOrderMaxMissingPackets is raised to it, and it is lowered to what the order correction cvars end up allowing.
+	*/
+	UPROPERTY(Config)
+	int32 LaneReorderWindow;
+
+	/** Strict lane priorities, lower values are sent first */
+	UPROPERTY(Config)
+	int32 GameplayLanePriority;
+
+	UPROPERTY(Config)
+	int32 VoiceLanePriority;
+
+	UPROPERTY(Config)
+	int32 BulkLanePriority;
+
+	/** Bandwidth share between lanes that have the same priority */
+	UPROPERTY(Config)
+	int32 GameplayLaneWeight;
+
+	UPROPERTY(Config)
+	int32 VoiceLaneWeight;
+
+	UPROPERTY(Config)
+	int32 BulkLaneWeight;
+
+	/** Takes ownership of a message built by FSteamCoreSocket::AllocateSendMessage, it is sent on the next flush */
+	void QueueOutgoingMessage(SteamNetworkingMessage_t* Message) { m_OutgoingMessages.Add(Message); }
+
+	/** Hands every queued message to Steam */
+	void FlushOutgoingMessages();
+
 protected:
 	class FSteamCoreSocket* m_Socket;
 	bool m_bIsDelayedNetworkAccess;
 
+	// Set while this driver counts towards the shared packet order correction cvars
+	bool m_bUsesPacketOrderCorrection;
+
+	// Reused receive buffer for TickDispatch, sized from ReceiveBatchSize
+	TArray<SteamNetworkingMessage_t*> m_ReceiveBuffer;
+
+	// Messages queued by connections this frame and the per message results of the last flush
+	TArray<SteamNetworkingMessage_t*> m_OutgoingMessages;
+	TArray<int64> m_OutgoingResults;
+	TArray<FSteamCoreSocketsSentMessage> m_OutgoingSent;
+
+	// Client connections keyed by their socket handle so inbound packets are routed without walking ClientConnections
+	TMap<SteamCoreSocketHandles, class USteamCoreSocketsNetConnection*> m_ConnectionsByHandle;
+
+	// Network thread used when bUseNetworkThread is set, started once the socket can receive
+	TSharedPtr<class FSteamCoreSocketsIOThread> m_IOThread;
+
 	void ResetSocketInfo(const class FSteamCoreSocket* RemovedSocket);
 
+	/** Turns on the engine's packet order correction for lane overtaking and clamps LaneReorderWindow to it, false when it stays off */
+	bool EnablePacketOrderCorrection();
+
+	/** Drops this driver's hold on the packet order correction cvars, restoring them once no driver holds them */
+	void ReleasePacketOrderCorrection();
+
+	/** Applies the lane settings to a new connection when bUseConnectionLanes is set */
+	void ConfigureConnectionLanes(class FSteamCoreSocket* ConnectionSocket) const;
+
+	void StartNetworkThread();
+	void StopNetworkThread();
+
+	/** Counts the lane stats of the batches the network thread has sent */
+	void CountNetworkThreadSends();
+
+	/** Adds messages Steam accepted to the lane stats of their sockets */
+	void CountSentMessages(TConstArrayView<FSteamCoreSocketsSentMessage> SentMessages);
+
+	/** Routes received messages to their connections and releases them */
+	void DispatchMessages(SteamNetworkingMessage_t** Messages, int32 NumMessages);
+
 	UNetConnection* FindClientConnectionForHandle(SteamCoreSocketHandles SocketHandle);
 
 	void OnConnectionCreated(SteamCoreSocketHandles ListenParentHandle, SteamCoreSocketHandles SocketHandle);
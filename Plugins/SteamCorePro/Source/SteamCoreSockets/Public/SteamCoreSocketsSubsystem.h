@@ -33,9 +33,13 @@ public:
 		: m_bShouldTestPeek(false),
 		  m_LastSocketError(0),
 		  m_bUseRelays(true),
+		  m_bUseLoopbackTransport(false),
 		  m_SteamEventManager(nullptr),
 		  m_SteamAPIClientHandle(nullptr),
-		  m_SteamAPIServerHandle(nullptr)
+		  m_SteamAPIServerHandle(nullptr),
+		  m_PendingDeletionHead(0),
+		  m_StatsSampleInterval(1.0f),
+		  m_LastStatsSampleTime(0.0)
 	{
 	}
 
@@ -76,19 +80,29 @@ public:
 	//~ End FSelfRegisteringExec Interface
 
 	bool IsUsingRelayNetwork() const { return m_bUseRelays; }
-	bool IsSteamInitialized() const { return m_SteamAPIClientHandle.IsValid() || m_SteamAPIServerHandle.IsValid(); }
+	bool IsSteamInitialized() const { return m_bUseLoopbackTransport || m_SteamAPIClientHandle.IsValid() || m_SteamAPIServerHandle.IsValid(); }
+	bool IsUsingLoopbackTransport() const { return m_bUseLoopbackTransport; }
 
 	static class ISteamNetworkingSockets* GetSteamSocketsInterface();
 
+	/** Transport every socket sends and receives through, Steam unless the loopback transport is enabled */
+	static class ISteamCoreSocketsTransport* GetTransport();
+
+	/** Replaces the transport, only allowed while no sockets exist */
+	bool SetTransport(TSharedPtr<class ISteamCoreSocketsTransport, ESPMode::ThreadSafe> NewTransport);
+
 PACKAGE_SCOPE:
 	struct FSteamCoreSocketInformation
 	{
-		FSteamCoreSocketInformation(TSharedPtr<FInternetAddr> InAddr, FSteamCoreSocket* InSocket, FSteamCoreSocket* InParent = nullptr)
-			: m_Addr(InAddr),
+		FSteamCoreSocketInformation(SteamCoreSocketHandles InHandle, TSharedPtr<FInternetAddr> InAddr, FSteamCoreSocket* InSocket, FSteamCoreSocket* InParent = nullptr, SteamCoreSocketHandles InParentHandle = 0)
+			: m_Handle(InHandle),
+			  m_ParentHandle(InParentHandle),
+			  m_Addr(InAddr),
 			  m_Socket(InSocket),
 			  m_Parent(InParent),
 			  m_NetDriver(nullptr),
-			  m_bMarkedForDeletion(false)
+			  m_bMarkedForDeletion(false),
+			  m_NextPendingDeletion(0)
 		{
 		}
 
@@ -115,14 +129,71 @@ PACKAGE_SCOPE:
 
 		FString ToString() const;
 
+		SteamCoreSocketHandles m_Handle;
+		SteamCoreSocketHandles m_ParentHandle;
 		TSharedPtr<FInternetAddr> m_Addr;
 		FSteamCoreSocket* m_Socket;
 		FSteamCoreSocket* m_Parent;
 		TWeakObjectPtr<USteamCoreSocketsNetDriver> m_NetDriver;
 	private:
 		bool m_bMarkedForDeletion;
+		/** Next entry in the subsystem's pending deletion list */
+		SteamCoreSocketHandles m_NextPendingDeletion;
+
+		friend class FSteamCoreSocketsSubsystem;
+	};
+
+	struct FSteamCoreSocketLaneStats
+	{
+		int32 PendingUnreliable = 0;
+		int32 PendingReliable = 0;
+		int32 SentUnackedReliable = 0;
+		int64 QueueTimeUsec = 0;
+		int64 BytesSent = 0;
+		int64 PacketsSent = 0;
+	};
+
+	/** Last real time status sampled for a connection */
+	struct FSteamCoreSocketConnectionStats
+	{
+		FString Address;
+		int32 Ping = 0;
+		/** Fraction of packets delivered intact and in order, as seen locally and by the peer */
+		float QualityLocal = 0.0f;
+		float QualityRemote = 0.0f;
+		float OutPacketsPerSec = 0.0f;
+		float OutBytesPerSec = 0.0f;
+		float InPacketsPerSec = 0.0f;
+		float InBytesPerSec = 0.0f;
+		int32 SendRateBytesPerSec = 0;
+		int32 PendingUnreliable = 0;
+		int32 PendingReliable = 0;
+		int32 SentUnackedReliable = 0;
+		int64 QueueTimeUsec = 0;
+		TArray<FSteamCoreSocketLaneStats, TInlineAllocator<4>> Lanes;
+		double SampleTime = 0.0;
+
+		FString ToString() const;
 	};
 
+	/** Totals over every connection from the last sample */
+	struct FSteamCoreSocketAggregateStats
+	{
+		int32 NumConnections = 0;
+		int32 MaxPing = 0;
+		float AveragePing = 0.0f;
+		float MinQuality = 1.0f;
+		float OutBytesPerSec = 0.0f;
+		float InBytesPerSec = 0.0f;
+		int32 PendingUnreliable = 0;
+		int32 PendingReliable = 0;
+		int32 SentUnackedReliable = 0;
+		int64 MaxQueueTimeUsec = 0;
+	};
+
+	const FSteamCoreSocketConnectionStats* GetConnectionStats(SteamCoreSocketHandles SocketHandle) const { return m_ConnectionStats.Find(SocketHandle); }
+	const FSteamCoreSocketAggregateStats& GetAggregateStats() const { return m_AggregateStats; }
+
 	FSteamCoreSocketInformation* GetSocketInfo(SteamCoreSocketHandles InternalSocketHandle);
 	FSteamCoreSocketInformation* GetSocketInfo(const FInternetAddr& ForAddress);
 
@@ -152,17 +223,51 @@ protected:
 		FString ToString() const;
 	};
 
+	/** Destroys the sockets on the pending deletion list, or every tracked socket when bForceClean is set */
 	void CleanSocketInformation(bool bForceClean);
+	void QueuePendingDeletion(FSteamCoreSocketInformation& SocketInfo);
 	void DumpSocketInformationMap() const;
 
+	void SampleConnectionStats();
+	void PublishConnectionStats() const;
+	void DumpConnectionStats() const;
+
+#if !UE_BUILD_SHIPPING
+	/** Runs FSteamCoreSocketsBenchmark with the options on the command line and writes the result as json */
+	void RunBenchmark(const TCHAR* Cmd);
+#endif
+
+	void IndexSocketAddress(SteamCoreSocketHandles SocketHandle, const FSteamCoreSocketInformation& SocketInfo);
+	void UnindexSocketAddress(SteamCoreSocketHandles SocketHandle, const FSteamCoreSocketInformation& SocketInfo);
+
 	bool m_bUseRelays;
+	bool m_bUseLoopbackTransport;
 	static FSteamCoreSocketsSubsystem* m_SocketSingleton;
+	TSharedPtr<class ISteamCoreSocketsTransport, ESPMode::ThreadSafe> m_Transport;
 	TUniquePtr<class FSteamCoreSocketsTaskManagerInterface> m_SteamEventManager;
 	TSharedPtr<class FSteamCoreClientInstanceHandler> m_SteamAPIClientHandle;
 	TSharedPtr<class FSteamCoreServerInstanceHandler> m_SteamAPIServerHandle;
 	typedef TMap<SteamCoreSocketHandles, FSteamCoreSocketInformation> SocketHandleInfoMap;
 	SocketHandleInfoMap m_SocketInformationMap;
+	/**
+	 * Address hash to handle for every tracked socket with a valid address, added in AddSocket and dropped when the
+	 * socket leaves m_SocketInformationMap. Sockets marked for deletion can still be listed and hashes can collide,
+	 * so GetSocketInfo skips marked sockets and compares the full address of every candidate.
+	 */
+	TMultiMap<uint32, SteamCoreSocketHandles> m_SocketAddressIndex;
+	/** Listener handle to the connections accepted on it */
+	TMultiMap<SteamCoreSocketHandles, SteamCoreSocketHandles> m_SocketChildren;
+	/** Head of the list of entries marked for deletion, linked through FSteamCoreSocketInformation */
+	SteamCoreSocketHandles m_PendingDeletionHead;
 	TArray<FSteamPendingSocketInformation> m_PendingListenerArray;
+
+	/** Seconds between connection stat samples, 0 disables sampling */
+	float m_StatsSampleInterval;
+	double m_LastStatsSampleTime;
+	TMap<SteamCoreSocketHandles, FSteamCoreSocketConnectionStats> m_ConnectionStats;
+	FSteamCoreSocketAggregateStats m_AggregateStats;
 	FDelegateHandle m_SteamServerLoginDelegateHandle;
+
+	friend class FSteamCoreSocketsBenchmark;
 };
 #endif
@@ -10,3 +10,22 @@
 #endif
 
 typedef uint32 SteamCoreSocketHandles;
+
+/** Kinds of traffic a connection can send on separate lanes, the value is the lane index */
+enum class ESteamCoreSocketsTrafficClass : uint8
+{
+	/** Control channel, RPCs, acks and PacketHandler traffic */
+	Gameplay,
+	Voice,
+	/** Split reliable bunches such as initial replication and large transfers */
+	Bulk,
+	Count
+};
+
+/** A batched message Steam accepted, lane stats are counted from these once the send result is known */
+struct FSteamCoreSocketsSentMessage
+{
+	SteamCoreSocketHandles Connection;
+	uint16 Lane;
+	int32 Size;
+};
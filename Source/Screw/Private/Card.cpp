@@ -15,9 +15,27 @@ void ACard::BeginPlay()
 void ACard::InitializeCard(const FCardData& NewCardData)
 {
     CardData = NewCardData;
+
+    if (!bCardInUse)
+    {
+        bCardInUse = true;
+        SetActorHiddenInGame(false);
+        SetActorEnableCollision(true);
+    }
+
     UE_LOG(LogTemp, Log, TEXT("Card Initialized: Name = %s, Ability = %d"), *CardData.Name, static_cast<uint8>(CardData.Ability));
 }
 
+void ACard::ReleaseCard()
+{
+    bCardInUse = false;
+    CardData = FCardData();
+    CardId = INDEX_NONE;
+
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+}
+
 void ACard::PrintCardDetails() const
 {
     FString AbilityString = UEnum::GetValueAsString(CardData.Ability);
@@ -2,66 +2,464 @@
 #include "Card.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
-#include "Kismet/GameplayStatics.h"
+#include "GameFramework/GameModeBase.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "TimerManager.h"
+#include "Net/UnrealNetwork.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "ScrewTableSubsystem.h"
 
 ACardManager::ACardManager()
 {
     PrimaryActorTick.bCanEverTick = false;
+
+    CardInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("CardInstances"));
+    CardInstances->NumCustomDataFloats = 1;
+    CardInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    RootComponent = CardInstances;
+
+    // Replicates card backs to every client, faces go through the per-owner AScrewHandView actors
+    bReplicates = true;
+    bAlwaysRelevant = true;
+}
+
+void ACardManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ACardManager, HandSizes);
+    DOREPLIFETIME(ACardManager, SeatTransforms);
 }
 
 void ACardManager::BeginPlay()
 {
     Super::BeginPlay();
+
+    // Seat players as they log in instead of scanning the level for controllers on every deal
+    if (HasAuthority())
+    {
+        // A bound table seats its own players, everyone else in the world may be at another table
+        if (TableId == INDEX_NONE)
+        {
+            for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+            {
+                RegisterPlayer(It->Get());
+            }
+        }
+
+        PostLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &ACardManager::HandleGameModePostLogin);
+        LogoutHandle = FGameModeEvents::GameModeLogoutEvent.AddUObject(this, &ACardManager::HandleGameModeLogout);
+
+        if (UScrewTableSubsystem* TableSubsystem = GetWorld()->GetSubsystem<UScrewTableSubsystem>())
+        {
+            TablePlayerRemovedHandle = TableSubsystem->OnTablePlayerRemoved.AddUObject(this, &ACardManager::HandleTablePlayerRemoved);
+        }
+    }
+
+    if (bUseInstancedRendering)
+    {
+        CardInstances->SetStaticMesh(CardInstanceMesh);
+        if (CardAtlasMaterial)
+        {
+            CardInstances->SetMaterial(0, CardAtlasMaterial);
+        }
+    }
+
+    // Spawn one full deck worth of cards up front so dealing never has to spawn actors, cards only exist on the server
+    if (HasAuthority() && EnsureCardCatalog())
+    {
+        PrewarmCardPool(CardCatalog->GetDeckTemplate().Num() + ExtraPooledCards);
+    }
+}
+
+void ACardManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorldTimerManager().ClearTimer(AbilityFlushHandle);
+
+    for (AScrewHandView* HandView : HandViews)
+    {
+        if (IsValid(HandView))
+        {
+            HandView->Destroy();
+        }
+    }
+    HandViews.Empty();
+
+    FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginHandle);
+    FGameModeEvents::GameModeLogoutEvent.Remove(LogoutHandle);
+    if (UScrewTableSubsystem* TableSubsystem = GetWorld()->GetSubsystem<UScrewTableSubsystem>())
+    {
+        TableSubsystem->OnTablePlayerRemoved.Remove(TablePlayerRemovedHandle);
+    }
+
+    // Cards still held in hands are not in the pool, destroy both so nothing outlives the manager
+    for (FPlayerHand& PlayerHand : PlayerHands)
+    {
+        CardPool.Append(PlayerHand.Cards);
+    }
+    PlayerHands.Empty();
+
+    for (ACard* Card : CardPool)
+    {
+        if (IsValid(Card))
+        {
+            Card->Destroy();
+        }
+    }
+    CardPool.Empty();
+    CardInstanceIndices.Empty();
+    CardInstances->ClearInstances();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+FScrewTable* ACardManager::FindBoundTable() const
+{
+    if (TableId == INDEX_NONE || !GetWorld())
+    {
+        return nullptr;
+    }
+
+    UScrewTableSubsystem* TableSubsystem = GetWorld()->GetSubsystem<UScrewTableSubsystem>();
+    return TableSubsystem ? TableSubsystem->FindTable(TableId) : nullptr;
+}
+
+FScrewMatchState& ACardManager::GetActiveMatchState()
+{
+    FScrewTable* Table = FindBoundTable();
+    return Table ? Table->State : LocalMatchState;
+}
+
+FScrewMatchLog& ACardManager::GetActiveMatchLog()
+{
+    FScrewTable* Table = FindBoundTable();
+    return Table ? Table->Log : LocalMatchLog;
+}
+
+const FScrewMatchState& ACardManager::GetMatchState() const
+{
+    const FScrewTable* Table = FindBoundTable();
+    return Table ? Table->State : LocalMatchState;
+}
+
+const FScrewMatchLog& ACardManager::GetMatchLog() const
+{
+    const FScrewTable* Table = FindBoundTable();
+    return Table ? Table->Log : LocalMatchLog;
+}
+
+bool ACardManager::EnsureCardCatalog()
+{
+    if (!CardCatalog.IsValid())
+    {
+        // Share the table's catalog so card ids mean the same thing in its state and in our card actors
+        if (const FScrewTable* Table = FindBoundTable())
+        {
+            CardCatalog = Table->State.GetCatalog();
+        }
+        else if (CardDataTable)
+        {
+            CardCatalog = FScrewCardCatalog::Build(CardDataTable);
+        }
+        LocalMatchState.SetCatalog(CardCatalog);
+    }
+
+    return CardCatalog.IsValid();
 }
 
 void ACardManager::InitializeDeck()
 {
-    if (!CardDataTable)
+    // A bound table shares its catalog, so only a local match needs its own Data Table
+    if (!EnsureCardCatalog())
     {
         UE_LOG(LogTemp, Error, TEXT("CardManager: CardDataTable is not set!"));
         return;
     }
 
-    static const FString ContextString(TEXT("Card Data Context"));
+    BeginMatch();
+
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    MatchState.InitializeDeck();
+    GetActiveMatchLog().LogInitializeDeck();
+
+    UE_LOG(LogTemp, Log, TEXT("Initialized Deck with %d card entries."), MatchState.GetDeckNum());
+}
+
+void ACardManager::ShuffleDeck()
+{
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+
+    if (!MatchState.ShuffleDeck())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CardManager: Cannot shuffle an empty deck!"));
+        return;
+    }
+    MatchLog.LogShuffleDeck();
+
+    UE_LOG(LogTemp, Log, TEXT("Deck shuffled."));
+}
+
+void ACardManager::PrewarmCardPool(int32 Count)
+{
+    if (!CardClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CardManager: CardClass is not set, cannot prewarm the card pool!"));
+        return;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = this;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    CardPool.Reserve(Count);
+    while (CardPool.Num() < Count)
+    {
+        ACard* NewCard = GetWorld()->SpawnActor<ACard>(CardClass, GetActorTransform(), SpawnParams);
+        if (!IsValid(NewCard))
+        {
+            UE_LOG(LogTemp, Error, TEXT("CardManager: Failed to spawn pooled card!"));
+            break;
+        }
+
+        NewCard->ReleaseCard();
+        CardPool.Add(NewCard);
+        UpdateCardInstance(NewCard);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CardManager: Card pool holds %d cards."), CardPool.Num());
+}
+
+ACard* ACardManager::AcquireCardFromPool(const FTransform& Transform, AController* Controller)
+{
+    while (CardPool.Num() > 0)
+    {
+        ACard* PooledCard = CardPool.Pop(EAllowShrinking::No);
+        if (IsValid(PooledCard))
+        {
+            PooledCard->SetOwner(Controller);
+            PooledCard->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+            return PooledCard;
+        }
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("CardManager: Card pool is empty, spawning a new card."));
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = Controller;
+    return GetWorld()->SpawnActor<ACard>(CardClass, Transform, SpawnParams);
+}
+
+void ACardManager::ReleaseCardToPool(ACard* Card)
+{
+    if (!IsValid(Card) || !Card->IsCardInUse())
+    {
+        return;
+    }
+
+    Card->ReleaseCard();
+    Card->SetOwner(this);
+    CardPool.Add(Card);
+    UpdateCardInstance(Card);
+}
+
+void ACardManager::UpdateCardInstance(ACard* Card)
+{
+    if (!bUseInstancedRendering)
+    {
+        return;
+    }
+
+    int32* InstanceIndex = CardInstanceIndices.Find(Card);
+    if (!InstanceIndex)
+    {
+        InstanceIndex = &CardInstanceIndices.Add(Card, CardInstances->AddInstance(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), true));
+    }
 
-    TArray<FName> RowNames = CardDataTable->GetRowNames();
-    for (const FName& RowName : RowNames)
+    if (!Card->IsCardInUse())
     {
-        FCardData* RowData = CardDataTable->FindRow<FCardData>(RowName, ContextString);
-        if (RowData)
+        // Zero scale keeps the instance index stable for the next time the card is dealt
+        CardInstances->UpdateInstanceTransform(*InstanceIndex, FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), true, true, true);
+        return;
+    }
+
+    // Faces are only drawn for cards the local player has been shown, everything else shows the back
+    const APlayerController* LocalPlayer = GetWorld()->GetFirstPlayerController();
+    const bool bLocalCard = LocalPlayer && LocalPlayer->IsLocalController() && Card->GetOwner() == LocalPlayer;
+
+    CardInstances->UpdateInstanceTransform(*InstanceIndex, Card->GetActorTransform(), true, false, true);
+    CardInstances->SetCustomDataValue(*InstanceIndex, 0, GetCardAtlasValue(GetLocallyVisibleCardId(Card), CardBackAtlasIndex), true);
+
+    // The actor stays as an invisible hit proxy, and only for cards the local player can click
+    Card->SetActorHiddenInGame(true);
+    Card->SetActorEnableCollision(bLocalCard);
+}
+
+float ACardManager::GetCardAtlasValue(int32 CardId, int32 BackAtlasIndex)
+{
+    return static_cast<float>(CardId == INDEX_NONE ? BackAtlasIndex : BackAtlasIndex + 1 + CardId);
+}
+
+int32 ACardManager::GetLocallyVisibleCardId(const ACard* Card) const
+{
+    APlayerController* LocalPlayer = GetWorld()->GetFirstPlayerController();
+    const int32 LocalSeat = (LocalPlayer && LocalPlayer->IsLocalController()) ? GetSeatIndex(LocalPlayer) : INDEX_NONE;
+    if (LocalSeat == INDEX_NONE || Card->CardId == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+
+    for (int32 Seat = 0; Seat < PlayerHands.Num(); Seat++)
+    {
+        const int32 CardIndex = PlayerHands[Seat].Cards.Find(const_cast<ACard*>(Card));
+        if (CardIndex == INDEX_NONE)
         {
-            for (int32 i = 0; i < RowData->Quantity; i++)
+            continue;
+        }
+
+        const bool bKnown = KnownReveals.ContainsByPredicate([LocalSeat, Seat, CardIndex](const FScrewCardReveal& Known)
+        {
+            return Known.ViewerSeat == LocalSeat && Known.Slot.Seat == Seat && Known.Slot.CardIndex == CardIndex;
+        });
+        return bKnown ? Card->CardId : INDEX_NONE;
+    }
+    return INDEX_NONE;
+}
+
+void ACardManager::RefreshCardInstances()
+{
+    if (!bUseInstancedRendering)
+    {
+        return;
+    }
+
+    for (const FPlayerHand& PlayerHand : PlayerHands)
+    {
+        for (ACard* Card : PlayerHand.Cards)
+        {
+            if (IsValid(Card))
             {
-                Deck.Add(*RowData);
+                UpdateCardInstance(Card);
             }
         }
     }
+}
 
-    UE_LOG(LogTemp, Log, TEXT("Initialized Deck with %d card entries."), Deck.Num());
+FTransform ACardManager::GetHandSlotTransform(const FTransform& SeatTransform, int32 CardIndex) const
+{
+    const int32 Cols = 2;
+    const int32 Row = CardIndex / Cols;
+    const int32 Col = CardIndex % Cols;
+
+    const FVector ForwardVector = SeatTransform.GetUnitAxis(EAxis::X);
+    const FVector RightVector = SeatTransform.GetUnitAxis(EAxis::Y);
+
+    // Calculate Grid Origin
+    FVector GridOrigin = SeatTransform.GetLocation() + (ForwardVector * ForwardOffset) + FVector(0.f, 0.f, VerticalOffset);
+    GridOrigin -= RightVector * ((HorizontalCardSpacing) / 2); // Center Grid Horizontally
+    GridOrigin -= ForwardVector * ((VerticalCardSpacing) / 2); // Center Grid Vertically
+
+    const FVector CardPosition = GridOrigin
+        + (RightVector * Col * HorizontalCardSpacing)  // Horizontal Spacing
+        + (ForwardVector * Row * VerticalCardSpacing); // Vertical Spacing
+
+    FRotator CardRotation = ForwardVector.Rotation();
+    CardRotation.Yaw += 180.0f;
+
+    return FTransform(CardRotation, CardPosition);
 }
 
-void ACardManager::ShuffleDeck()
+void ACardManager::RegisterLocalHandView(AScrewHandView* View)
 {
-    if (Deck.Num() == 0)
+    if (!IsValid(View) || LocalHandView == View)
     {
-        UE_LOG(LogTemp, Warning, TEXT("CardManager: Cannot shuffle an empty deck!"));
         return;
     }
 
-    for (int32 i = Deck.Num() - 1; i > 0; i--)
+    LocalHandView = View;
+    View->OnKnownCardsChanged.AddUniqueDynamic(this, &ACardManager::HandleLocalKnownCardsChanged);
+    View->OnKnownCardsRemoved.AddUniqueDynamic(this, &ACardManager::HandleLocalKnownCardsChanged);
+    RefreshRemoteCardInstances();
+}
+
+void ACardManager::HandleLocalKnownCardsChanged(const TArray<FScrewVisibleCard>& Cards)
+{
+    RefreshRemoteCardInstances();
+}
+
+void ACardManager::RefreshRemoteCardInstances()
+{
+    // The server and a listen host draw from their card actors instead
+    if (!bUseInstancedRendering || HasAuthority())
     {
-        int32 SwapIndex = FMath::RandRange(0, i);
-        Deck.Swap(i, SwapIndex);
+        return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Deck shuffled."));
+    UpdateRemoteCardInstances(LocalHandView.IsValid() ? LocalHandView->GetKnownCards() : TArray<FScrewVisibleCard>());
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+void ACardManager::SetRemoteLayoutForTest(const TArray<uint8>& InHandSizes, const TArray<FTransform>& InSeatTransforms, TConstArrayView<FScrewVisibleCard> KnownCards)
+{
+    HandSizes = InHandSizes;
+    SeatTransforms = InSeatTransforms;
+    UpdateRemoteCardInstances(KnownCards);
+}
+#endif
+
+void ACardManager::UpdateRemoteCardInstances(TConstArrayView<FScrewVisibleCard> KnownCards)
+{
+    int32 NumCards = 0;
+    for (int32 Seat = 0; Seat < HandSizes.Num() && Seat < SeatTransforms.Num(); Seat++)
+    {
+        NumCards += HandSizes[Seat];
+    }
+
+    // Instances are reused in order, only the difference in card count is added or removed
+    while (CardInstances->GetInstanceCount() > NumCards)
+    {
+        CardInstances->RemoveInstance(CardInstances->GetInstanceCount() - 1);
+    }
+    while (CardInstances->GetInstanceCount() < NumCards)
+    {
+        CardInstances->AddInstance(FTransform::Identity, true);
+    }
+
+    int32 InstanceIndex = 0;
+    for (int32 Seat = 0; Seat < HandSizes.Num() && Seat < SeatTransforms.Num(); Seat++)
+    {
+        for (int32 CardIndex = 0; CardIndex < HandSizes[Seat]; CardIndex++)
+        {
+            const FScrewVisibleCard* Known = KnownCards.FindByPredicate([Seat, CardIndex](const FScrewVisibleCard& Card)
+            {
+                return Card.Seat == Seat && Card.CardIndex == CardIndex;
+            });
+
+            CardInstances->UpdateInstanceTransform(InstanceIndex, GetHandSlotTransform(SeatTransforms[Seat], CardIndex), true, false, true);
+            CardInstances->SetCustomDataValue(InstanceIndex, 0, GetCardAtlasValue(Known ? Known->CardId : INDEX_NONE, CardBackAtlasIndex), false);
+            InstanceIndex++;
+        }
+    }
+
+    CardInstances->MarkRenderStateDirty();
+}
+
+void ACardManager::ReleaseAllHands()
+{
+    for (FPlayerHand& PlayerHand : PlayerHands)
+    {
+        for (ACard* Card : PlayerHand.Cards)
+        {
+            ReleaseCardToPool(Card);
+        }
+    }
+    PlayerHands.Reset();
 }
 
 ACard* ACardManager::SpawnCardAtLocation_Implementation(const FCardData& CardData, const FTransform& Transform, AController* Controller)
 {
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = Controller;
-    ACard* NewCard = GetWorld()->SpawnActor<ACard>(CardClass, Transform, SpawnParams);
+    ACard* NewCard = AcquireCardFromPool(Transform, Controller);
 
     if (IsValid(NewCard))
     {
@@ -77,137 +475,177 @@ ACard* ACardManager::SpawnCardAtLocation_Implementation(const FCardData& CardDat
 
 void ACardManager::DealCardsToPlayers_Implementation()
 {
-    // Load all Player Controllers
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AController::StaticClass(), (TArray<AActor*>&)Controllers);
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
 
-    if (Deck.Num() < CardsPerPlayer * Controllers.Num())
+    if (TableId != INDEX_NONE)
+    {
+        SyncSeatsWithTable();
+    }
+    else
+    {
+        CompactSeatRegistry();
+    }
+
+    if (MatchState.GetDeckNum() < CardsPerPlayer * SeatIndices.Num())
     {
         UE_LOG(LogTemp, Error, TEXT("Not enough cards in the deck to deal to all players!"));
         return;
     }
 
-    for (AController* Controller : Controllers)
+    // Seats follow the seat registry, vacant seats stay empty
+    MatchState.ResetSeats(Controllers.Num());
+    MatchLog.LogResetSeats(Controllers.Num());
+    ReleaseAllHands();
+    PlayerHands.SetNum(Controllers.Num());
+    KnownReveals.Reset();
+    SeatTransforms.Reset();
+    SeatTransforms.SetNum(Controllers.Num());
+
+    // 2x2 Grid
+    const int32 Rows = 2;
+    const int32 Cols = 2;
+
+    for (int32 Seat = 0; Seat < Controllers.Num(); Seat++)
     {
+        AController* Controller = Controllers[Seat];
         if (!IsValid(Controller) || !IsValid(Controller->GetPawn()))
         {
             UE_LOG(LogTemp, Warning, TEXT("Invalid Controller or Pawn detected. Skipping."));
             continue;
         }
 
-        APawn* PlayerPawn = Controller->GetPawn();
-        FVector PlayerLocation = PlayerPawn->GetActorLocation();
-        FVector ForwardVector = PlayerPawn->GetActorForwardVector();
-        FVector RightVector = PlayerPawn->GetActorRightVector();
-
-        // Calculate Grid Origin
-        FVector GridOrigin = PlayerLocation + (ForwardVector * ForwardOffset) + FVector(0.f, 0.f, VerticalOffset);
-        GridOrigin -= RightVector * ((HorizontalCardSpacing) / 2); // Center Grid Horizontally
-        GridOrigin -= ForwardVector * ((VerticalCardSpacing) / 2); // Center Grid Vertically
-
-        FPlayerHand PlayerHand;
-
-        // 2x2 Grid
-        const int32 Rows = 2;
-        const int32 Cols = 2;
-        int32 CardIndex = 0;
-
-        for (int32 Row = 0; Row < Rows; Row++)
+        if (MatchState.DealToSeat(Seat, Rows * Cols) != EScrewRuleResult::Ok)
         {
-            for (int32 Col = 0; Col < Cols; Col++)
-            {
-                if (Deck.Num() == 0)
-                {
-                    UE_LOG(LogTemp, Error, TEXT("Deck ran out of cards while dealing to player %s!"), *Controller->GetName());
-                    break;
-                }
-
-                FCardData CardData = Deck.Pop();
-
-                FVector CardPosition = GridOrigin
-                    + (RightVector * Col * HorizontalCardSpacing)  // Horizontal Spacing
-                    + (ForwardVector * Row * VerticalCardSpacing); // Vertical Spacing
+            UE_LOG(LogTemp, Error, TEXT("Deck ran out of cards while dealing to player %s!"), *Controller->GetName());
+            continue;
+        }
+        MatchLog.LogDeal(Seat, Rows * Cols);
 
-                FRotator CardRotation = ForwardVector.Rotation();
-                CardRotation.Yaw += 180.0f;
+        // Clients lay out their card backs from the same seat transform
+        APawn* PlayerPawn = Controller->GetPawn();
+        SeatTransforms[Seat] = FTransform(PlayerPawn->GetActorRotation(), PlayerPawn->GetActorLocation());
 
-                FTransform CardTransform(CardRotation, CardPosition);
-                ACard* SpawnedCard = SpawnCardAtLocation(CardData, CardTransform, Controller);
+        const TArray<FScrewCardId>& Hand = MatchState.GetHand(Seat);
+        FPlayerHand& PlayerHand = PlayerHands[Seat];
 
-                if (IsValid(SpawnedCard))
-                {
-                    PlayerHand.Cards.Add(SpawnedCard);
-                }
+        for (int32 CardIndex = 0; CardIndex < Rows * Cols; CardIndex++)
+        {
+            ACard* SpawnedCard = SpawnCatalogCard(Hand[CardIndex], GetHandSlotTransform(SeatTransforms[Seat], CardIndex), Controller);
 
-                CardIndex++;
-            }
+            // Keep the actor hand index-aligned with the match state hand, even if the spawn failed
+            PlayerHand.Cards.Add(SpawnedCard);
         }
-        PlayerHands.Add(Controller, PlayerHand);
     }
 
+    SyncHandViews();
+
     UE_LOG(LogTemp, Log, TEXT("All players have been dealt their cards in a 2x2 grid at proper positions."));
 }
 
 void ACardManager::GrantCard(AController* Controller, ACard* Card, FTransform Transform) {
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+
     if (!IsValid(Controller) || !IsValid(Controller->GetPawn()) || !IsValid(Card))
     {
         UE_LOG(LogTemp, Warning, TEXT("Invalid Controller or Pawn or card detected."));
         return;
     }
 
-    FCardData CardData = Card->CardData;
-    ACard* SpawnedCard = SpawnCardAtLocation(CardData, Transform, Controller);
-
-    if (IsValid(SpawnedCard))
+    const FScrewCardId CardId = Card->CardId != INDEX_NONE ? static_cast<FScrewCardId>(Card->CardId) : ScrewInvalidCardId;
+    const int32 Seat = GetSeatIndex(Controller);
+    const EScrewRuleResult Result = MatchState.GrantCard(Seat, CardId);
+    if (Result == EScrewRuleResult::InvalidSeat)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Controller not found in PlayerHands map!"));
+        return;
+    }
+    else if (Result != EScrewRuleResult::Ok)
     {
-        GetPlayerHand(Controller).Add(SpawnedCard);
+        UE_LOG(LogTemp, Warning, TEXT("Card %s is not part of the card catalog."), *Card->CardData.Name);
+        return;
     }
+    MatchLog.LogGrant(Seat, CardId);
+
+    ACard* SpawnedCard = SpawnCatalogCard(CardId, Transform, Controller);
+    PlayerHands[Seat].Cards.Add(SpawnedCard);
+    RememberOwnNewestCard(Seat);
+
+    SyncHandViews();
 }
 
 ACard* ACardManager::GrantCardFromDeck(AController* Controller, FTransform Transform) {
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+
     if (!IsValid(Controller) || !IsValid(Controller->GetPawn()))
     {
         UE_LOG(LogTemp, Warning, TEXT("Invalid Controller or Pawn detected."));
         return nullptr;
     }
 
-    if (Deck.Num() == 0)
+    if (MatchState.GetDeckNum() == 0)
     {
         UE_LOG(LogTemp, Warning, TEXT("Deck ran out of cards, regenerating!"));
-        InitializeDeck();
-        ShuffleDeck();
     }
 
-    FCardData CardData = Deck.Pop();
-    ACard* SpawnedCard = SpawnCardAtLocation(CardData, Transform, Controller);
-
-    if (IsValid(SpawnedCard))
+    FScrewCardId DrawnCardId;
+    const int32 Seat = GetSeatIndex(Controller);
+    const EScrewRuleResult Result = MatchState.DrawCard(Seat, DrawnCardId);
+    if (Result == EScrewRuleResult::InvalidSeat)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Controller not found in PlayerHands map!"));
+        return nullptr;
+    }
+    else if (Result != EScrewRuleResult::Ok)
     {
-        GetPlayerHand(Controller).Add(SpawnedCard);
+        UE_LOG(LogTemp, Error, TEXT("CardManager: Deck is empty and could not be regenerated!"));
+        return nullptr;
     }
+    MatchLog.LogDraw(Seat, DrawnCardId);
+
+    ACard* SpawnedCard = SpawnCatalogCard(DrawnCardId, Transform, Controller);
+    PlayerHands[Seat].Cards.Add(SpawnedCard);
+    RememberOwnNewestCard(Seat);
+
+    SyncHandViews();
 
     return SpawnedCard;
 }
 
 void ACardManager::AdvanceTurn_Implementation()
 {
-    if (Controllers.Num() == 0)
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+
+    if (SeatIndices.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No players to take turns!"));
+        return;
+    }
+
+    // Seats vacated since the deal are passed over by the match state as part of this one advance
+    if (MatchState.AdvanceTurn() != EScrewRuleResult::Ok)
     {
         UE_LOG(LogTemp, Warning, TEXT("No players to take turns!"));
         return;
     }
+    MatchLog.LogAdvanceTurn(MatchState.GetCurrentTurnSeat());
 
-    TurnCount++;
-    CurrentTurnIndex = (CurrentTurnIndex + 1) % Controllers.Num();
-    CurrentTurnPlayer = Controllers[CurrentTurnIndex];
+    TurnCount = MatchState.GetTurnCount();
+    CurrentTurnIndex = MatchState.GetCurrentTurnSeat();
+    CurrentTurnPlayer = Controllers.IsValidIndex(CurrentTurnIndex) ? Controllers[CurrentTurnIndex] : nullptr;
 
-    UE_LOG(LogTemp, Log, TEXT("It's now Player %s's turn."), *CurrentTurnPlayer->GetName());
+    UE_LOG(LogTemp, Log, TEXT("It's now Player %s's turn."), *GetNameSafe(CurrentTurnPlayer));
 }
 
 TArray<ACard*> ACardManager::GetPlayerHand(AController* Controller)
 {
-    if (PlayerHands.Contains(Controller))
+    const int32 Seat = GetSeatIndex(Controller);
+    if (PlayerHands.IsValidIndex(Seat))
     {
-        return PlayerHands[Controller].Cards;
+        return PlayerHands[Seat].Cards;
     }
 
     UE_LOG(LogTemp, Warning, TEXT("Controller not found in PlayerHands map!"));
@@ -216,29 +654,524 @@ TArray<ACard*> ACardManager::GetPlayerHand(AController* Controller)
 
 void ACardManager::PlayCard_Implementation(AController* Controller, int32 CardIndex)
 {
-    if (!PlayerHands.Contains(Controller))
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+
+    const int32 Seat = GetSeatIndex(Controller);
+    if (!PlayerHands.IsValidIndex(Seat))
     {
         UE_LOG(LogTemp, Warning, TEXT("Controller not found in PlayerHands map!"));
         return;
     }
 
-    FPlayerHand& PlayerHand = PlayerHands[Controller];
+    // Validate against both the model and the actors before either is changed so they cannot drift apart
+    FPlayerHand* PlayerHand = &PlayerHands[Seat];
+    if (!MatchState.IsValidSeat(Seat) || !MatchState.GetHand(Seat).IsValidIndex(CardIndex) || !PlayerHand->Cards.IsValidIndex(CardIndex))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Invalid card index selected by Player %s!"), *GetNameSafe(Controller));
+        return;
+    }
 
-    if (!PlayerHand.Cards.IsValidIndex(CardIndex))
+    FScrewCardId PlayedCardId;
+    const EScrewRuleResult Result = MatchState.PlayCard(Seat, CardIndex, PlayedCardId);
+    if (Result != EScrewRuleResult::Ok)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Invalid card index selected by Player %s!"), *Controller->GetName());
+        UE_LOG(LogTemp, Warning, TEXT("Player %s could not play card %d (rule result %d)"), *GetNameSafe(Controller), CardIndex, static_cast<int32>(Result));
         return;
     }
 
-    ACard* PlayedCard = PlayerHand.Cards[CardIndex];
+    MatchLog.LogPlay(Seat, CardIndex, PlayedCardId);
+    const ECardAbility PlayedAbility = CardCatalog->GetAbility(PlayedCardId);
+    if (PlayedAbility != ECardAbility::None)
+    {
+        MatchLog.LogAbility(Seat, PlayedAbility);
+    }
+
+    ACard* PlayedCard = PlayerHand->Cards[CardIndex];
+    PlayerHand->Cards.RemoveAt(CardIndex);
+    ForgetRemovedSlot(Seat, CardIndex);
+
+    SyncHandViews();
+
     if (IsValid(PlayedCard))
     {
         UE_LOG(LogTemp, Log, TEXT("Player %s played card: %s"), *Controller->GetName(), *PlayedCard->GetName());
         PlayedCard->PrintCardDetails();
-        PlayerHand.Cards.RemoveAt(CardIndex);
+        ReleaseCardToPool(PlayedCard);
     }
     else
     {
         UE_LOG(LogTemp, Warning, TEXT("The selected card is invalid!"));
     }
 }
+
+bool ACardManager::QueueAbility(AController* Controller, ECardAbility Ability, const TArray<FScrewAbilityTarget>& Targets)
+{
+    FScrewMatchState& MatchState = GetActiveMatchState();
+
+    FScrewAbilityCommand Command;
+    Command.Seat = GetSeatIndex(Controller);
+    Command.Ability = Ability;
+    for (const FScrewAbilityTarget& Target : Targets)
+    {
+        FScrewCardSlot& Slot = Command.Targets.AddDefaulted_GetRef();
+        Slot.Seat = GetSeatIndex(Target.Player);
+        Slot.CardIndex = Target.CardIndex;
+    }
+
+    const EScrewRuleResult Result = MatchState.ValidateAbility(Command);
+    if (Result != EScrewRuleResult::Ok)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CardManager: Rejected ability %d from %s (result %d)."), static_cast<int32>(Ability), *GetNameSafe(Controller), static_cast<int32>(Result));
+        return false;
+    }
+
+    if (AbilityQueue.Num() == 0)
+    {
+        AbilityFlushHandle = GetWorldTimerManager().SetTimerForNextTick(this, &ACardManager::FlushAbilityQueue);
+    }
+    AbilityQueue.Add(MoveTemp(Command));
+    return true;
+}
+
+void ACardManager::FlushAbilityQueue()
+{
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+
+    PendingReveals.Reset();
+
+    for (const FScrewAbilityCommand& Command : AbilityQueue)
+    {
+        // Earlier commands in the batch may have moved or discarded the targeted cards
+        const EScrewRuleResult Result = MatchState.ResolveAbility(Command, PendingReveals);
+        if (Result != EScrewRuleResult::Ok)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("CardManager: Ability %d of seat %d failed to resolve (result %d)."), static_cast<int32>(Command.Ability), Command.Seat, static_cast<int32>(Result));
+            continue;
+        }
+
+        MatchLog.LogResolveAbility(Command);
+        ApplyAbilityToHands(Command);
+    }
+    AbilityQueue.Reset();
+
+    // Own cards are hidden until peeked at as well, so every reveal is remembered
+    for (const FScrewCardReveal& Reveal : PendingReveals)
+    {
+        RememberReveal(Reveal);
+    }
+
+    SyncHandViews();
+}
+
+void ACardManager::RememberReveal(const FScrewCardReveal& Reveal)
+{
+    KnownReveals.RemoveAllSwap([&Reveal](const FScrewCardReveal& Known)
+    {
+        return Known.ViewerSeat == Reveal.ViewerSeat && Known.Slot == Reveal.Slot;
+    }, EAllowShrinking::No);
+    KnownReveals.Add(Reveal);
+}
+
+void ACardManager::RememberOwnNewestCard(int32 Seat)
+{
+    // The player taking a card looks at it
+    const TArray<FScrewCardId>& Hand = GetActiveMatchState().GetHand(Seat);
+
+    FScrewCardReveal Reveal;
+    Reveal.ViewerSeat = Seat;
+    Reveal.Slot.Seat = Seat;
+    Reveal.Slot.CardIndex = Hand.Num() - 1;
+    Reveal.CardId = Hand.Last();
+    RememberReveal(Reveal);
+}
+
+void ACardManager::ForgetRemovedSlot(int32 Seat, int32 CardIndex)
+{
+    KnownReveals.RemoveAllSwap([Seat, CardIndex](const FScrewCardReveal& Known)
+    {
+        return Known.Slot.Seat == Seat && Known.Slot.CardIndex == CardIndex;
+    }, EAllowShrinking::No);
+
+    // Later cards of the hand moved down one slot, what was known about them moves along
+    for (FScrewCardReveal& Known : KnownReveals)
+    {
+        if (Known.Slot.Seat == Seat && Known.Slot.CardIndex > CardIndex)
+        {
+            Known.Slot.CardIndex--;
+        }
+    }
+}
+
+void ACardManager::ApplyAbilityToHands(const FScrewAbilityCommand& Command)
+{
+    if (Command.Targets.Num() == 0)
+    {
+        return;
+    }
+
+    const FScrewCardSlot& First = Command.Targets[0];
+    switch (Command.Ability)
+    {
+    case ECardAbility::SwapOneNoReveal:
+    case ECardAbility::RevealOneAndSwap:
+    {
+        const FScrewCardSlot& Second = Command.Targets[1];
+        if (!PlayerHands.IsValidIndex(First.Seat) || !PlayerHands.IsValidIndex(Second.Seat)
+            || !PlayerHands[First.Seat].Cards.IsValidIndex(First.CardIndex) || !PlayerHands[Second.Seat].Cards.IsValidIndex(Second.CardIndex))
+        {
+            break;
+        }
+
+        ACard*& FirstCard = PlayerHands[First.Seat].Cards[First.CardIndex];
+        ACard*& SecondCard = PlayerHands[Second.Seat].Cards[Second.CardIndex];
+
+        // Cards trade places on the table as well as in the hands
+        if (IsValid(FirstCard) && IsValid(SecondCard))
+        {
+            const FTransform FirstTransform = FirstCard->GetActorTransform();
+            FirstCard->SetActorTransform(SecondCard->GetActorTransform(), false, nullptr, ETeleportType::TeleportPhysics);
+            SecondCard->SetActorTransform(FirstTransform, false, nullptr, ETeleportType::TeleportPhysics);
+            FirstCard->SetOwner(Controllers[Second.Seat]);
+            SecondCard->SetOwner(Controllers[First.Seat]);
+            UpdateCardInstance(FirstCard);
+            UpdateCardInstance(SecondCard);
+        }
+        Swap(FirstCard, SecondCard);
+        break;
+    }
+    case ECardAbility::DiscardOneSelf:
+        if (PlayerHands.IsValidIndex(First.Seat) && PlayerHands[First.Seat].Cards.IsValidIndex(First.CardIndex))
+        {
+            ReleaseCardToPool(PlayerHands[First.Seat].Cards[First.CardIndex]);
+            PlayerHands[First.Seat].Cards.RemoveAt(First.CardIndex);
+            ForgetRemovedSlot(First.Seat, First.CardIndex);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+AScrewHandView* ACardManager::GetHandView(AController* Controller) const
+{
+    const int32 Seat = GetSeatIndex(Controller);
+    return HandViews.IsValidIndex(Seat) ? HandViews[Seat] : nullptr;
+}
+
+void ACardManager::SyncHandViews()
+{
+    FScrewMatchState& MatchState = GetActiveMatchState();
+
+    // Reveals go stale once the revealed slot holds a different card or no longer exists
+    KnownReveals.RemoveAllSwap([&MatchState](const FScrewCardReveal& Known)
+    {
+        return !MatchState.IsValidSeat(Known.Slot.Seat) || !MatchState.GetHand(Known.Slot.Seat).IsValidIndex(Known.Slot.CardIndex)
+            || MatchState.GetHand(Known.Slot.Seat)[Known.Slot.CardIndex] != Known.CardId;
+    }, EAllowShrinking::No);
+
+    HandSizes.SetNum(MatchState.GetNumSeats());
+    for (int32 Seat = 0; Seat < MatchState.GetNumSeats(); Seat++)
+    {
+        HandSizes[Seat] = static_cast<uint8>(FMath::Min(MatchState.GetHand(Seat).Num(), MAX_uint8));
+    }
+
+    TArray<FScrewCardReveal> Visible;
+    for (int32 Seat = 0; Seat < HandViews.Num(); Seat++)
+    {
+        AScrewHandView* HandView = HandViews[Seat];
+        if (!IsValid(HandView))
+        {
+            continue;
+        }
+
+        // Only cards the seat has been shown, its own hand stays face down until it peeks or draws
+        Visible.Reset();
+        for (const FScrewCardReveal& Known : KnownReveals)
+        {
+            if (Known.ViewerSeat == Seat)
+            {
+                Visible.Add(Known);
+            }
+        }
+
+        HandView->SetKnownCards(Seat, Visible);
+    }
+
+    // The server never receives its own replicated properties
+    OnHandSizesChanged();
+    RefreshCardInstances();
+}
+
+void ACardManager::OnRep_HandSizes()
+{
+    OnHandSizesChanged();
+    RefreshRemoteCardInstances();
+}
+
+void ACardManager::OnRep_SeatTransforms()
+{
+    RefreshRemoteCardInstances();
+}
+
+void ACardManager::BeginMatch()
+{
+    const FScrewTable* Table = FindBoundTable();
+    const int32 FixedSeed = Table ? Table->Seed : MatchSeed;
+    const int32 Seed = (FixedSeed != 0) ? FixedSeed : FMath::Rand();
+
+    FScrewMatchLog& MatchLog = GetActiveMatchLog();
+    GetActiveMatchState().BeginMatch(Seed);
+    MatchLog.Reset();
+    MatchLog.LogMatchStart(Seed);
+
+    // The previous match's cards went back into the rebuilt deck
+    ReleaseAllHands();
+    SyncHandViews();
+
+    UE_LOG(LogTemp, Log, TEXT("CardManager: Match started with seed %d."), Seed);
+}
+
+bool ACardManager::SaveMatchLog(const FString& FileName) const
+{
+    const FScrewMatchLog& MatchLog = GetMatchLog();
+    if (!MatchLog.SaveToFile(FileName))
+    {
+        UE_LOG(LogTemp, Error, TEXT("CardManager: Failed to save match log to %s"), *FileName);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CardManager: Saved %d match events (%d bytes) to %s"), MatchLog.GetNumEvents(), MatchLog.GetData().Num(), *FileName);
+    return true;
+}
+
+bool ACardManager::ReplayMatchLog(const FString& FileName, int32 Turn, TArray<int32>& OutHandValues) const
+{
+    OutHandValues.Reset();
+
+    if (!CardCatalog.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("CardManager: Cannot replay a match without a card catalog!"));
+        return false;
+    }
+
+    FScrewMatchLog ReplayLog;
+    if (!ReplayLog.LoadFromFile(FileName))
+    {
+        UE_LOG(LogTemp, Error, TEXT("CardManager: Failed to load match log %s"), *FileName);
+        return false;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    FScrewMatchState ReplayState;
+    ReplayState.SetCatalog(CardCatalog);
+
+    int32 EventIndex = INDEX_NONE;
+    const EScrewReplayResult Result = FScrewMatchReplay::Replay(ReplayLog, ReplayState, Turn, EventIndex);
+
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    if (Result != EScrewReplayResult::Ok)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CardManager: Replay of %s failed with result %d at event %d"), *FileName, static_cast<int32>(Result), EventIndex);
+        return false;
+    }
+
+    for (int32 Seat = 0; Seat < ReplayState.GetNumSeats(); Seat++)
+    {
+        OutHandValues.Add(ReplayState.GetHandValue(Seat));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CardManager: Replayed %d events to turn %d in %.3f ms"), EventIndex + 1, ReplayState.GetTurnCount(), ElapsedMs);
+    return true;
+}
+
+int32 ACardManager::GetSeatIndex(AController* Controller) const
+{
+    const int32* Seat = SeatIndices.Find(Controller);
+    return Seat ? *Seat : INDEX_NONE;
+}
+
+int32 ACardManager::RegisterPlayer(AController* Controller)
+{
+    if (!IsValid(Controller))
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* ExistingSeat = SeatIndices.Find(Controller))
+    {
+        return *ExistingSeat;
+    }
+
+    // A seat vacated during the running match still holds the previous player's hand, only seats outside the match are reused
+    int32 Seat = Controllers.Num();
+    for (int32 Index = 0; Index < Controllers.Num(); Index++)
+    {
+        if (Controllers[Index] == nullptr && !GetMatchState().IsValidSeat(Index))
+        {
+            Seat = Index;
+            break;
+        }
+    }
+    SeatPlayer(Controller, Seat);
+    return Seat;
+}
+
+void ACardManager::SeatPlayer(AController* Controller, int32 Seat)
+{
+    if (Controllers.Num() <= Seat)
+    {
+        Controllers.SetNum(Seat + 1);
+    }
+    Controllers[Seat] = Controller;
+    SeatIndices.Add(Controller, Seat);
+
+    // Bots read the match state directly and never need a replicated view
+    HandViews.SetNum(Controllers.Num());
+    if (HasAuthority() && Controller->IsPlayerController())
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = Controller;
+        HandViews[Seat] = GetWorld()->SpawnActor<AScrewHandView>(SpawnParams);
+        if (HandViews[Seat])
+        {
+            HandViews[Seat]->SetCardManager(this);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CardManager: Player %s took seat %d."), *Controller->GetName(), Seat);
+}
+
+void ACardManager::UnregisterPlayer(AController* Controller)
+{
+    int32 Seat = INDEX_NONE;
+    if (!SeatIndices.RemoveAndCopyValue(Controller, Seat))
+    {
+        return;
+    }
+
+    Controllers[Seat] = nullptr;
+
+    FScrewMatchState& MatchState = GetActiveMatchState();
+    if (MatchState.IsValidSeat(Seat) && !MatchState.IsSeatVacant(Seat))
+    {
+        MatchState.SetSeatVacant(Seat);
+        GetActiveMatchLog().LogSeatVacated(Seat);
+    }
+
+    if (HandViews.IsValidIndex(Seat) && IsValid(HandViews[Seat]))
+    {
+        HandViews[Seat]->Destroy();
+    }
+    HandViews.SetNum(Controllers.Num());
+    HandViews[Seat] = nullptr;
+
+    // Trailing vacant seats can be dropped without moving anyone else
+    while (Controllers.Num() > 0 && Controllers.Last() == nullptr && !MatchState.IsValidSeat(Controllers.Num() - 1))
+    {
+        Controllers.Pop();
+        HandViews.Pop();
+    }
+
+    if (CurrentTurnPlayer == Controller)
+    {
+        CurrentTurnPlayer = nullptr;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CardManager: Player %s left seat %d."), *GetNameSafe(Controller), Seat);
+}
+
+void ACardManager::HandleGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+    if (GameMode && GameMode->GetWorld() == GetWorld() && TableId == INDEX_NONE)
+    {
+        RegisterPlayer(NewPlayer);
+    }
+}
+
+void ACardManager::HandleGameModeLogout(AGameModeBase* GameMode, AController* Exiting)
+{
+    if (GameMode && GameMode->GetWorld() == GetWorld())
+    {
+        UnregisterPlayer(Exiting);
+    }
+}
+
+void ACardManager::HandleTablePlayerRemoved(int32 RemovedTableId, AController* Player, int32 Seat)
+{
+    if (RemovedTableId == TableId)
+    {
+        UnregisterPlayer(Player);
+    }
+}
+
+void ACardManager::SyncSeatsWithTable()
+{
+    FScrewTable* Table = FindBoundTable();
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CardManager: Table %d is not hosted, keeping the current seats."), TableId);
+        return;
+    }
+
+    // Called right before a deal, the one point where the table may renumber its seats
+    Table->CompactSeats();
+
+    TArray<AController*> Seated;
+    SeatIndices.GetKeys(Seated);
+    for (AController* Controller : Seated)
+    {
+        if (Table->Players.IndexOfByKey(TWeakObjectPtr<AController>(Controller)) != GetSeatIndex(Controller))
+        {
+            UnregisterPlayer(Controller);
+        }
+    }
+
+    // Registry seats are the table's seats, so both sides address the same hand
+    for (int32 Seat = 0; Seat < Table->Players.Num(); Seat++)
+    {
+        AController* Controller = Table->Players[Seat].Get();
+        if (Controller && GetSeatIndex(Controller) == INDEX_NONE)
+        {
+            SeatPlayer(Controller, Seat);
+        }
+    }
+    Controllers.SetNum(Table->Players.Num());
+    HandViews.SetNum(Controllers.Num());
+}
+
+void ACardManager::CompactSeatRegistry()
+{
+    HandViews.SetNum(Controllers.Num());
+
+    int32 NextSeat = 0;
+    for (int32 Seat = 0; Seat < Controllers.Num(); Seat++)
+    {
+        if (Controllers[Seat] == nullptr)
+        {
+            continue;
+        }
+
+        Controllers[NextSeat] = Controllers[Seat];
+        HandViews[NextSeat] = HandViews[Seat];
+        SeatIndices.Add(Controllers[NextSeat], NextSeat);
+        NextSeat++;
+    }
+
+    Controllers.SetNum(NextSeat);
+    HandViews.SetNum(NextSeat);
+}
+
+ACard* ACardManager::SpawnCatalogCard(FScrewCardId CardId, const FTransform& Transform, AController* Controller)
+{
+    ACard* SpawnedCard = SpawnCardAtLocation(CardCatalog->GetCardData(CardId), Transform, Controller);
+    if (IsValid(SpawnedCard))
+    {
+        SpawnedCard->CardId = CardId;
+        UpdateCardInstance(SpawnedCard);
+    }
+    return SpawnedCard;
+}
@@ -0,0 +1,159 @@
+#include "ScrewBotController.h"
+#include "CardManager.h"
+#include "GameFramework/Pawn.h"
+
+AScrewBotController::AScrewBotController()
+{
+    PrimaryActorTick.bCanEverTick = true;
+}
+
+void AScrewBotController::JoinTable(ACardManager* InCardManager)
+{
+    LeaveTable();
+
+    CardManager = InCardManager;
+    if (IsValid(CardManager))
+    {
+        CardManager->RegisterPlayer(this);
+    }
+}
+
+void AScrewBotController::LeaveTable()
+{
+    if (IsValid(CardManager))
+    {
+        CardManager->UnregisterPlayer(this);
+    }
+    CardManager = nullptr;
+    PlannedTurn = INDEX_NONE;
+}
+
+void AScrewBotController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // The task owns copies of everything it reads, waiting keeps shutdown deterministic
+    if (PlanTask.IsValid())
+    {
+        PlanTask.Wait();
+        PlanTask = {};
+    }
+
+    LeaveTable();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AScrewBotController::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (!IsValid(CardManager))
+    {
+        return;
+    }
+
+    if (PlanTask.IsValid())
+    {
+        if (PlanTask.IsCompleted())
+        {
+            const FScrewBotMove Move = PlanTask.GetResult();
+            PlanTask = {};
+
+            // The turn may have moved on while the bot was thinking
+            if (CardManager->CurrentTurnPlayer == this && CardManager->GetMatchState().GetTurnCount() == PlannedTurn)
+            {
+                ExecuteMove(Move);
+            }
+        }
+        return;
+    }
+
+    const FScrewMatchState& MatchState = CardManager->GetMatchState();
+    if (CardManager->CurrentTurnPlayer != this || MatchState.GetTurnCount() == PlannedTurn)
+    {
+        return;
+    }
+
+    PlannedTurn = MatchState.GetTurnCount();
+
+    FScrewBotPlannerSettings Settings;
+    Settings.TimeBudgetSeconds = MoveTimeBudget;
+    Settings.NumTrees = ParallelTrees;
+    Settings.PlayoutTurns = PlayoutTurns;
+
+    const int32 Seat = CardManager->GetSeatIndex(this);
+    const int32 Seed = MatchState.GetSeed() ^ (PlannedTurn * 131) ^ Seat;
+
+    // The bot plans with exactly the cards it has been shown, like a human in its seat
+    TArray<FScrewCardSlot> KnownSlots;
+    GatherKnownSlots(Seat, KnownSlots);
+
+    PlanTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Snapshot = MatchState, Seat, KnownSlots = MoveTemp(KnownSlots), Settings, Seed]()
+    {
+        return FScrewBotPlanner::Plan(Snapshot, Seat, KnownSlots, Settings, Seed);
+    });
+}
+
+void AScrewBotController::GatherKnownSlots(int32 Seat, TArray<FScrewCardSlot>& OutSlots) const
+{
+    OutSlots.Reset();
+    for (const FScrewCardReveal& Known : CardManager->KnownReveals)
+    {
+        if (Known.ViewerSeat == Seat)
+        {
+            OutSlots.Add(Known.Slot);
+        }
+    }
+}
+
+void AScrewBotController::ExecuteMove(const FScrewBotMove& Move)
+{
+    if (Move.Type == EScrewBotMoveType::Play)
+    {
+        CardManager->PlayCard(this, Move.CardIndex);
+        QueuePendingAbilities();
+    }
+    else if (APawn* BotPawn = GetPawn())
+    {
+        const FVector Location = BotPawn->GetActorLocation() + BotPawn->GetActorForwardVector() * CardManager->ForwardOffset;
+        CardManager->GrantCardFromDeck(this, FTransform(BotPawn->GetActorRotation(), Location));
+    }
+
+    if (bAdvanceTurnAfterMove)
+    {
+        CardManager->AdvanceTurn();
+    }
+}
+
+void AScrewBotController::QueuePendingAbilities()
+{
+    const FScrewMatchState& MatchState = CardManager->GetMatchState();
+    const int32 Seat = CardManager->GetSeatIndex(this);
+    FRandomStream Stream(MatchState.GetSeed() ^ MatchState.GetTurnCount() ^ Seat);
+
+    // Targets are picked in a world built from what the bot has seen, the live hands would show it every card
+    TArray<FScrewCardSlot> KnownSlots;
+    GatherKnownSlots(Seat, KnownSlots);
+    FScrewMatchState Determinized = MatchState;
+    Determinized.Determinize(KnownSlots, Stream);
+
+    FScrewAbilityCommand Command;
+    TArray<FScrewAbilityTarget> Targets;
+    for (const FScrewPendingAbility& Pending : MatchState.GetPendingAbilities())
+    {
+        if (Pending.Seat != Seat)
+        {
+            continue;
+        }
+
+        FScrewBotPlanner::MakeAbilityCommand(Determinized, Pending, Stream, Command);
+
+        Targets.Reset();
+        for (const FScrewCardSlot& Slot : Command.Targets)
+        {
+            FScrewAbilityTarget& Target = Targets.AddDefaulted_GetRef();
+            Target.Player = CardManager->Controllers[Slot.Seat];
+            Target.CardIndex = Slot.CardIndex;
+        }
+        CardManager->QueueAbility(this, Pending.Ability, Targets);
+    }
+}
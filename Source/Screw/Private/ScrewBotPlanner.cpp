@@ -0,0 +1,340 @@
+#include "ScrewBotPlanner.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace ScrewBotPlanner
+{
+    struct FNode
+    {
+        FScrewBotMove Move;
+
+        /** Seat that made Move, rewards are stored from its point of view */
+        int32 Seat = INDEX_NONE;
+
+        int32 Visits = 0;
+
+        /** Times this node was legal when its parent was visited */
+        int32 Availability = 0;
+
+        double Reward = 0.0;
+
+        TArray<int32> Children;
+    };
+
+    struct FRootResult
+    {
+        TArray<FScrewBotMove> Moves;
+        TArray<int32> Visits;
+        int32 Iterations = 0;
+    };
+
+    /** 1 for the lowest hand, 0.5 when sharing the lowest hand, 0 otherwise */
+    static double ScoreSeat(const FScrewMatchState& State, int32 Seat)
+    {
+        const int32 Value = State.GetHandValue(Seat);
+        int32 Ties = 0;
+        for (int32 Other = 0; Other < State.GetNumSeats(); Other++)
+        {
+            if (Other == Seat)
+            {
+                continue;
+            }
+
+            const int32 OtherValue = State.GetHandValue(Other);
+            if (OtherValue < Value)
+            {
+                return 0.0;
+            }
+            Ties += (OtherValue == Value) ? 1 : 0;
+        }
+        return Ties > 0 ? 0.5 : 1.0;
+    }
+
+    static void SearchTree(const FScrewMatchState& Root, int32 Seat, TConstArrayView<FScrewCardSlot> KnownSlots, const FScrewBotPlannerSettings& Settings, int32 Seed, double Deadline, FRootResult& OutResult)
+    {
+        FRandomStream Stream(Seed);
+        TArray<FNode> Nodes;
+        Nodes.Reserve(4096);
+        Nodes.AddDefaulted();
+
+        TArray<FScrewBotMove> Legal;
+        TArray<FScrewBotMove> Untried;
+        TArray<int32> Path;
+        const int32 EndTurn = Root.GetTurnCount() + Settings.PlayoutTurns;
+
+        int32 Iteration = 0;
+        for (; Iteration < Settings.MaxIterations; Iteration++)
+        {
+            // Only read the clock every 16 iterations, reading it is measurable on small trees
+            if ((Iteration & 15) == 0 && FPlatformTime::Seconds() >= Deadline)
+            {
+                break;
+            }
+
+            FScrewMatchState World = Root;
+            World.Determinize(KnownSlots, Stream);
+            World.SetSeed(static_cast<int32>(Stream.GetUnsignedInt()));
+
+            int32 NodeIndex = 0;
+            Path.Reset();
+            Path.Add(NodeIndex);
+
+            // Selection and expansion
+            while (World.GetTurnCount() < EndTurn)
+            {
+                const int32 ActingSeat = World.GetCurrentTurnSeat();
+                FScrewBotPlanner::GetLegalMoves(World, ActingSeat, Legal);
+
+                Untried = Legal;
+                for (const int32 ChildIndex : Nodes[NodeIndex].Children)
+                {
+                    FNode& Child = Nodes[ChildIndex];
+                    if (Legal.Contains(Child.Move))
+                    {
+                        Child.Availability++;
+                        Untried.RemoveSingleSwap(Child.Move, EAllowShrinking::No);
+                    }
+                }
+
+                if (Untried.Num() > 0)
+                {
+                    const FScrewBotMove Move = Untried[Stream.RandHelper(Untried.Num())];
+                    const int32 ChildIndex = Nodes.AddDefaulted();
+                    Nodes[ChildIndex].Move = Move;
+                    Nodes[ChildIndex].Seat = ActingSeat;
+                    Nodes[ChildIndex].Availability = 1;
+                    Nodes[NodeIndex].Children.Add(ChildIndex);
+
+                    FScrewBotPlanner::ApplyMove(World, ActingSeat, Move, Stream);
+                    Path.Add(ChildIndex);
+                    break;
+                }
+
+                int32 BestChild = INDEX_NONE;
+                double BestScore = -1.0;
+                for (const int32 ChildIndex : Nodes[NodeIndex].Children)
+                {
+                    const FNode& Child = Nodes[ChildIndex];
+                    if (!Legal.Contains(Child.Move))
+                    {
+                        continue;
+                    }
+
+                    const double Score = Child.Reward / Child.Visits + Settings.Exploration * FMath::Sqrt(FMath::Loge(static_cast<double>(Child.Availability)) / Child.Visits);
+                    if (Score > BestScore)
+                    {
+                        BestScore = Score;
+                        BestChild = ChildIndex;
+                    }
+                }
+
+                FScrewBotPlanner::ApplyMove(World, ActingSeat, Nodes[BestChild].Move, Stream);
+                NodeIndex = BestChild;
+                Path.Add(NodeIndex);
+            }
+
+            // Random playout
+            while (World.GetTurnCount() < EndTurn)
+            {
+                const int32 ActingSeat = World.GetCurrentTurnSeat();
+                FScrewBotPlanner::GetLegalMoves(World, ActingSeat, Legal);
+                FScrewBotPlanner::ApplyMove(World, ActingSeat, Legal[Stream.RandHelper(Legal.Num())], Stream);
+            }
+
+            // Backpropagation, the root has no move of its own
+            for (int32 PathIndex = 1; PathIndex < Path.Num(); PathIndex++)
+            {
+                FNode& Node = Nodes[Path[PathIndex]];
+                Node.Visits++;
+                Node.Reward += ScoreSeat(World, Node.Seat);
+            }
+        }
+
+        OutResult.Iterations = Iteration;
+        for (const int32 ChildIndex : Nodes[0].Children)
+        {
+            OutResult.Moves.Add(Nodes[ChildIndex].Move);
+            OutResult.Visits.Add(Nodes[ChildIndex].Visits);
+        }
+    }
+}
+
+void FScrewBotPlanner::GetLegalMoves(const FScrewMatchState& State, int32 Seat, TArray<FScrewBotMove>& OutMoves)
+{
+    OutMoves.Reset();
+    OutMoves.AddDefaulted();
+
+    if (State.IsValidSeat(Seat))
+    {
+        for (int32 CardIndex = 0; CardIndex < State.GetHand(Seat).Num(); CardIndex++)
+        {
+            FScrewBotMove& Move = OutMoves.AddDefaulted_GetRef();
+            Move.Type = EScrewBotMoveType::Play;
+            Move.CardIndex = CardIndex;
+        }
+    }
+}
+
+void FScrewBotPlanner::ApplyMove(FScrewMatchState& State, int32 Seat, const FScrewBotMove& Move, FRandomStream& Stream)
+{
+    FScrewCardId CardId;
+    if (Move.Type == EScrewBotMoveType::Play)
+    {
+        State.PlayCard(Seat, Move.CardIndex, CardId);
+    }
+    else
+    {
+        State.DrawCard(Seat, CardId);
+    }
+
+    // Reveals only matter to a real player, the simulation just needs the swaps and discards
+    TArray<FScrewCardReveal> Reveals;
+    FScrewAbilityCommand Command;
+    while (State.GetPendingAbilities().Num() > 0)
+    {
+        MakeAbilityCommand(State, State.GetPendingAbilities()[0], Stream, Command);
+        if (State.ResolveAbility(Command, Reveals) != EScrewRuleResult::Ok)
+        {
+            FScrewPendingAbility Dropped;
+            State.PopPendingAbility(Dropped);
+        }
+    }
+
+    State.AdvanceTurn();
+}
+
+void FScrewBotPlanner::MakeAbilityCommand(const FScrewMatchState& State, const FScrewPendingAbility& Pending, FRandomStream& Stream, FScrewAbilityCommand& OutCommand)
+{
+    OutCommand.Seat = Pending.Seat;
+    OutCommand.Ability = Pending.Ability;
+    OutCommand.Targets.Reset();
+
+    if (!State.IsValidSeat(Pending.Seat))
+    {
+        return;
+    }
+
+    TArray<int32, TInlineAllocator<8>> Opponents;
+    for (int32 Seat = 0; Seat < State.GetNumSeats(); Seat++)
+    {
+        if (Seat != Pending.Seat && State.GetHand(Seat).Num() > 0)
+        {
+            Opponents.Add(Seat);
+        }
+    }
+
+    const TArray<FScrewCardId>& OwnHand = State.GetHand(Pending.Seat);
+
+    auto RandomSlot = [&State, &Stream](int32 Seat)
+    {
+        FScrewCardSlot Slot;
+        Slot.Seat = Seat;
+        Slot.CardIndex = Stream.RandHelper(State.GetHand(Seat).Num());
+        return Slot;
+    };
+
+    switch (Pending.Ability)
+    {
+    case ECardAbility::Selection:
+    case ECardAbility::RevealOpponentOne:
+        if (Opponents.Num() > 0)
+        {
+            OutCommand.Targets.Add(RandomSlot(Opponents[Stream.RandHelper(Opponents.Num())]));
+        }
+        break;
+    case ECardAbility::RevealSelfOne:
+        if (OwnHand.Num() > 0)
+        {
+            OutCommand.Targets.Add(RandomSlot(Pending.Seat));
+        }
+        break;
+    case ECardAbility::DiscardOneSelf:
+    {
+        // Drops the most expensive card of the hand as State shows it, unseen cards are only guesses in a determinized state
+        int32 BestIndex = INDEX_NONE;
+        for (int32 CardIndex = 0; CardIndex < OwnHand.Num(); CardIndex++)
+        {
+            if (BestIndex == INDEX_NONE || State.GetCatalog()->GetValue(OwnHand[CardIndex]) > State.GetCatalog()->GetValue(OwnHand[BestIndex]))
+            {
+                BestIndex = CardIndex;
+            }
+        }
+        if (BestIndex != INDEX_NONE)
+        {
+            FScrewCardSlot& Slot = OutCommand.Targets.AddDefaulted_GetRef();
+            Slot.Seat = Pending.Seat;
+            Slot.CardIndex = BestIndex;
+        }
+        break;
+    }
+    case ECardAbility::SwapOneNoReveal:
+    case ECardAbility::RevealOneAndSwap:
+        if (OwnHand.Num() > 0 && Opponents.Num() > 0)
+        {
+            OutCommand.Targets.Add(RandomSlot(Pending.Seat));
+            OutCommand.Targets.Add(RandomSlot(Opponents[Stream.RandHelper(Opponents.Num())]));
+        }
+        break;
+    case ECardAbility::RevealOneEachOpponent:
+        for (const int32 Seat : Opponents)
+        {
+            OutCommand.Targets.Add(RandomSlot(Seat));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+FScrewBotMove FScrewBotPlanner::Plan(const FScrewMatchState& State, int32 Seat, TConstArrayView<FScrewCardSlot> KnownSlots, const FScrewBotPlannerSettings& Settings, int32 Seed)
+{
+    FScrewBotMove BestMove;
+    if (!State.IsValidSeat(Seat) || State.GetCatalog() == nullptr)
+    {
+        return BestMove;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double Deadline = StartTime + Settings.TimeBudgetSeconds;
+    const int32 NumTrees = FMath::Max(Settings.NumTrees, 1);
+
+    TArray<ScrewBotPlanner::FRootResult> Results;
+    Results.SetNum(NumTrees);
+
+    ParallelFor(TEXT("ScrewBotPlanner"), NumTrees, 1, [&](int32 TreeIndex)
+    {
+        ScrewBotPlanner::SearchTree(State, Seat, KnownSlots, Settings, Seed + TreeIndex * 7919, Deadline, Results[TreeIndex]);
+    });
+
+    // Root parallelization, the most visited move across every tree wins
+    TArray<FScrewBotMove> Moves;
+    TArray<int32> Visits;
+    int32 TotalIterations = 0;
+    for (const ScrewBotPlanner::FRootResult& Result : Results)
+    {
+        TotalIterations += Result.Iterations;
+        for (int32 i = 0; i < Result.Moves.Num(); i++)
+        {
+            int32 MoveIndex = Moves.Find(Result.Moves[i]);
+            if (MoveIndex == INDEX_NONE)
+            {
+                MoveIndex = Moves.Add(Result.Moves[i]);
+                Visits.Add(0);
+            }
+            Visits[MoveIndex] += Result.Visits[i];
+        }
+    }
+
+    int32 BestVisits = -1;
+    for (int32 i = 0; i < Moves.Num(); i++)
+    {
+        if (Visits[i] > BestVisits)
+        {
+            BestVisits = Visits[i];
+            BestMove = Moves[i];
+        }
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("ScrewBotPlanner: Seat %d ran %d iterations over %d trees in %.2f ms."), Seat, TotalIterations, NumTrees, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return BestMove;
+}
@@ -0,0 +1,67 @@
+#include "ScrewCardCatalog.h"
+#include "Engine/DataTable.h"
+
+TSharedPtr<const FScrewCardCatalog> FScrewCardCatalog::Build(const UDataTable* CardDataTable)
+{
+    if (!CardDataTable)
+    {
+        return nullptr;
+    }
+
+    static const FString ContextString(TEXT("Card Catalog Context"));
+
+    TArray<FCardData*> RowData;
+    CardDataTable->GetAllRows<FCardData>(ContextString, RowData);
+
+    TArray<FCardData> Rows;
+    Rows.Reserve(RowData.Num());
+    for (const FCardData* Row : RowData)
+    {
+        if (Row)
+        {
+            Rows.Add(*Row);
+        }
+    }
+
+    return MakeShared<FScrewCardCatalog>(Rows);
+}
+
+FScrewCardCatalog::FScrewCardCatalog(const TArray<FCardData>& InRows)
+{
+    const int32 NumRows = FMath::Min(InRows.Num(), static_cast<int32>(ScrewInvalidCardId));
+    ensureMsgf(NumRows == InRows.Num(), TEXT("Card catalog supports at most %d rows, extra rows are ignored."), NumRows);
+
+    int32 DeckSize = 0;
+    for (int32 i = 0; i < NumRows; i++)
+    {
+        DeckSize += FMath::Max(InRows[i].Quantity, 0);
+    }
+
+    Rows.Reserve(NumRows);
+    Values.Reserve(NumRows);
+    Abilities.Reserve(NumRows);
+    DeckTemplate.Reserve(DeckSize);
+
+    for (int32 i = 0; i < NumRows; i++)
+    {
+        const FCardData& Row = InRows[i];
+        const FScrewCardId CardId = static_cast<FScrewCardId>(Rows.Add(Row));
+        Values.Add(Row.Value);
+        Abilities.Add(Row.Ability);
+
+        for (int32 Copy = 0; Copy < Row.Quantity; Copy++)
+        {
+            DeckTemplate.Add(CardId);
+        }
+    }
+}
+
+FScrewCardId FScrewCardCatalog::FindCardId(const FString& Name) const
+{
+    const int32 Index = Rows.IndexOfByPredicate([&Name](const FCardData& Row)
+    {
+        return Row.Name == Name;
+    });
+
+    return Index == INDEX_NONE ? ScrewInvalidCardId : static_cast<FScrewCardId>(Index);
+}
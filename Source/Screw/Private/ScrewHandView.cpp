@@ -0,0 +1,181 @@
+#include "ScrewHandView.h"
+#include "CardManager.h"
+#include "GameFramework/Controller.h"
+#include "Net/UnrealNetwork.h"
+
+void FScrewKnownCard::PreReplicatedRemove(const FScrewKnownCardArray& InArraySerializer)
+{
+    if (InArraySerializer.View)
+    {
+        InArraySerializer.View->AddRemovedCard(*this);
+    }
+}
+
+void FScrewKnownCard::PostReplicatedAdd(const FScrewKnownCardArray& InArraySerializer)
+{
+    if (InArraySerializer.View)
+    {
+        InArraySerializer.View->AddChangedCard(*this);
+    }
+}
+
+void FScrewKnownCard::PostReplicatedChange(const FScrewKnownCardArray& InArraySerializer)
+{
+    if (InArraySerializer.View)
+    {
+        InArraySerializer.View->AddChangedCard(*this);
+    }
+}
+
+void FScrewKnownCardArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (View)
+    {
+        View->BroadcastChangedCards();
+    }
+}
+
+AScrewHandView::AScrewHandView()
+{
+    bReplicates = true;
+    bOnlyRelevantToOwner = true;
+    bAlwaysRelevant = false;
+    SetReplicatingMovement(false);
+}
+
+void AScrewHandView::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    KnownCards.View = this;
+}
+
+void AScrewHandView::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(AScrewHandView, KnownCards);
+    DOREPLIFETIME(AScrewHandView, Seat);
+    DOREPLIFETIME(AScrewHandView, CardManager);
+}
+
+void AScrewHandView::OnRep_CardManager()
+{
+    // Clients have no card actors, the manager draws this player's faces from the view
+    if (CardManager)
+    {
+        CardManager->RegisterLocalHandView(this);
+    }
+}
+
+void AScrewHandView::SetKnownCards(int32 InSeat, TConstArrayView<FScrewCardReveal> Cards)
+{
+    Seat = InSeat;
+
+    // Hands only hold a handful of cards, a linear match per slot is cheaper than building a map
+    TArray<bool, TInlineAllocator<32>> Kept;
+    Kept.SetNumZeroed(KnownCards.Items.Num());
+
+    for (const FScrewCardReveal& Card : Cards)
+    {
+        const int32 ItemIndex = KnownCards.Items.IndexOfByPredicate([&Card](const FScrewKnownCard& Item)
+        {
+            return Item.Seat == Card.Slot.Seat && Item.CardIndex == Card.Slot.CardIndex;
+        });
+
+        if (ItemIndex == INDEX_NONE)
+        {
+            FScrewKnownCard& Item = KnownCards.Items.AddDefaulted_GetRef();
+            Item.Seat = static_cast<uint8>(Card.Slot.Seat);
+            Item.CardIndex = static_cast<uint8>(Card.Slot.CardIndex);
+            Item.CardId = Card.CardId;
+            KnownCards.MarkItemDirty(Item);
+            Kept.Add(true);
+            AddChangedCard(Item);
+        }
+        else
+        {
+            FScrewKnownCard& Item = KnownCards.Items[ItemIndex];
+            Kept[ItemIndex] = true;
+            if (Item.CardId != Card.CardId)
+            {
+                Item.CardId = Card.CardId;
+                KnownCards.MarkItemDirty(Item);
+                AddChangedCard(Item);
+            }
+        }
+    }
+
+    bool bRemoved = false;
+    for (int32 ItemIndex = KnownCards.Items.Num() - 1; ItemIndex >= 0; ItemIndex--)
+    {
+        if (!Kept[ItemIndex])
+        {
+            AddRemovedCard(KnownCards.Items[ItemIndex]);
+            KnownCards.Items.RemoveAtSwap(ItemIndex, 1, EAllowShrinking::No);
+            bRemoved = true;
+        }
+    }
+    if (bRemoved)
+    {
+        KnownCards.MarkArrayDirty();
+    }
+
+    // A listen server host never receives its own view, so it is notified here
+    const AController* OwningController = Cast<AController>(GetOwner());
+    if (OwningController && OwningController->IsLocalController())
+    {
+        BroadcastChangedCards();
+    }
+    else
+    {
+        ChangedCards.Reset();
+        RemovedCards.Reset();
+    }
+}
+
+TArray<FScrewVisibleCard> AScrewHandView::GetKnownCards() const
+{
+    TArray<FScrewVisibleCard> Cards;
+    Cards.Reserve(KnownCards.Items.Num());
+    for (const FScrewKnownCard& Item : KnownCards.Items)
+    {
+        FScrewVisibleCard& Card = Cards.AddDefaulted_GetRef();
+        Card.Seat = Item.Seat;
+        Card.CardIndex = Item.CardIndex;
+        Card.CardId = Item.CardId;
+    }
+    return Cards;
+}
+
+void AScrewHandView::AddChangedCard(const FScrewKnownCard& Item)
+{
+    FScrewVisibleCard& Card = ChangedCards.AddDefaulted_GetRef();
+    Card.Seat = Item.Seat;
+    Card.CardIndex = Item.CardIndex;
+    Card.CardId = Item.CardId;
+}
+
+void AScrewHandView::AddRemovedCard(const FScrewKnownCard& Item)
+{
+    FScrewVisibleCard& Card = RemovedCards.AddDefaulted_GetRef();
+    Card.Seat = Item.Seat;
+    Card.CardIndex = Item.CardIndex;
+    Card.CardId = Item.CardId;
+}
+
+void AScrewHandView::BroadcastChangedCards()
+{
+    // Removals go first, a slot can be hidden and shown again with a new card in the same update
+    if (RemovedCards.Num() > 0)
+    {
+        OnKnownCardsRemoved.Broadcast(RemovedCards);
+        RemovedCards.Reset();
+    }
+
+    if (ChangedCards.Num() > 0)
+    {
+        OnKnownCardsChanged.Broadcast(ChangedCards);
+        ChangedCards.Reset();
+    }
+}
@@ -0,0 +1,300 @@
+#include "ScrewMatchLog.h"
+#include "Misc/FileHelper.h"
+
+namespace ScrewMatchLog
+{
+    /** Payload size in bytes for an event type, INDEX_NONE for unknown types */
+    static int32 GetPayloadSize(uint8 Type)
+    {
+        switch (static_cast<EScrewMatchEvent>(Type))
+        {
+        case EScrewMatchEvent::MatchStart:      return 4;
+        case EScrewMatchEvent::InitializeDeck:  return 0;
+        case EScrewMatchEvent::ShuffleDeck:     return 0;
+        case EScrewMatchEvent::ResetSeats:      return 1;
+        case EScrewMatchEvent::Deal:            return 2;
+        case EScrewMatchEvent::Draw:            return 3;
+        case EScrewMatchEvent::Grant:           return 3;
+        case EScrewMatchEvent::Play:            return 4;
+        case EScrewMatchEvent::Ability:         return 2;
+        case EScrewMatchEvent::AdvanceTurn:     return 1;
+        case EScrewMatchEvent::AbilityTarget:   return 2;
+        case EScrewMatchEvent::ResolveAbility:  return 2;
+        case EScrewMatchEvent::SeatVacated:     return 1;
+        default:                                return INDEX_NONE;
+        }
+    }
+
+    static uint16 ReadUInt16(const uint8* Bytes)
+    {
+        return static_cast<uint16>(Bytes[0] | (Bytes[1] << 8));
+    }
+
+    static int32 ReadInt32(const uint8* Bytes)
+    {
+        return static_cast<int32>(static_cast<uint32>(Bytes[0]) | (static_cast<uint32>(Bytes[1]) << 8) | (static_cast<uint32>(Bytes[2]) << 16) | (static_cast<uint32>(Bytes[3]) << 24));
+    }
+}
+
+FScrewMatchLog::FScrewMatchLog()
+    : NumEvents(0)
+{
+    Reset();
+}
+
+void FScrewMatchLog::Reset()
+{
+    Data.Reset();
+    NumEvents = 0;
+
+    for (int32 Shift = 0; Shift < 32; Shift += 8)
+    {
+        WriteUInt8(static_cast<uint8>(Magic >> Shift));
+    }
+    WriteUInt8(Version);
+}
+
+void FScrewMatchLog::BeginEvent(EScrewMatchEvent Type)
+{
+    WriteUInt8(static_cast<uint8>(Type));
+    NumEvents++;
+}
+
+void FScrewMatchLog::WriteUInt16(uint16 Value)
+{
+    WriteUInt8(static_cast<uint8>(Value));
+    WriteUInt8(static_cast<uint8>(Value >> 8));
+}
+
+void FScrewMatchLog::WriteInt32(int32 Value)
+{
+    const uint32 Bits = static_cast<uint32>(Value);
+    for (int32 Shift = 0; Shift < 32; Shift += 8)
+    {
+        WriteUInt8(static_cast<uint8>(Bits >> Shift));
+    }
+}
+
+void FScrewMatchLog::LogMatchStart(int32 Seed)
+{
+    BeginEvent(EScrewMatchEvent::MatchStart);
+    WriteInt32(Seed);
+}
+
+void FScrewMatchLog::LogInitializeDeck()
+{
+    BeginEvent(EScrewMatchEvent::InitializeDeck);
+}
+
+void FScrewMatchLog::LogShuffleDeck()
+{
+    BeginEvent(EScrewMatchEvent::ShuffleDeck);
+}
+
+void FScrewMatchLog::LogResetSeats(int32 NumSeats)
+{
+    BeginEvent(EScrewMatchEvent::ResetSeats);
+    WriteUInt8(static_cast<uint8>(NumSeats));
+}
+
+void FScrewMatchLog::LogDeal(int32 Seat, int32 Count)
+{
+    BeginEvent(EScrewMatchEvent::Deal);
+    WriteUInt8(static_cast<uint8>(Seat));
+    WriteUInt8(static_cast<uint8>(Count));
+}
+
+void FScrewMatchLog::LogDraw(int32 Seat, FScrewCardId CardId)
+{
+    BeginEvent(EScrewMatchEvent::Draw);
+    WriteUInt8(static_cast<uint8>(Seat));
+    WriteUInt16(CardId);
+}
+
+void FScrewMatchLog::LogGrant(int32 Seat, FScrewCardId CardId)
+{
+    BeginEvent(EScrewMatchEvent::Grant);
+    WriteUInt8(static_cast<uint8>(Seat));
+    WriteUInt16(CardId);
+}
+
+void FScrewMatchLog::LogPlay(int32 Seat, int32 CardIndex, FScrewCardId CardId)
+{
+    BeginEvent(EScrewMatchEvent::Play);
+    WriteUInt8(static_cast<uint8>(Seat));
+    WriteUInt8(static_cast<uint8>(CardIndex));
+    WriteUInt16(CardId);
+}
+
+void FScrewMatchLog::LogAbility(int32 Seat, ECardAbility Ability)
+{
+    BeginEvent(EScrewMatchEvent::Ability);
+    WriteUInt8(static_cast<uint8>(Seat));
+    WriteUInt8(static_cast<uint8>(Ability));
+}
+
+void FScrewMatchLog::LogAdvanceTurn(int32 Seat)
+{
+    BeginEvent(EScrewMatchEvent::AdvanceTurn);
+    WriteUInt8(static_cast<uint8>(Seat));
+}
+
+void FScrewMatchLog::LogResolveAbility(const FScrewAbilityCommand& Command)
+{
+    for (const FScrewCardSlot& Target : Command.Targets)
+    {
+        BeginEvent(EScrewMatchEvent::AbilityTarget);
+        WriteUInt8(static_cast<uint8>(Target.Seat));
+        WriteUInt8(static_cast<uint8>(Target.CardIndex));
+    }
+
+    BeginEvent(EScrewMatchEvent::ResolveAbility);
+    WriteUInt8(static_cast<uint8>(Command.Seat));
+    WriteUInt8(static_cast<uint8>(Command.Ability));
+}
+
+void FScrewMatchLog::LogSeatVacated(int32 Seat)
+{
+    BeginEvent(EScrewMatchEvent::SeatVacated);
+    WriteUInt8(static_cast<uint8>(Seat));
+}
+
+bool FScrewMatchLog::SetData(TArray<uint8>&& InData)
+{
+    if (InData.Num() < HeaderSize || ScrewMatchLog::ReadInt32(InData.GetData()) != static_cast<int32>(Magic) || InData[4] == 0 || InData[4] > Version)
+    {
+        return false;
+    }
+
+    // Count events up front so the log reports the same size it had when it was written
+    int32 EventCount = 0;
+    int32 Offset = HeaderSize;
+    while (Offset < InData.Num())
+    {
+        const int32 PayloadSize = ScrewMatchLog::GetPayloadSize(InData[Offset]);
+        if (PayloadSize == INDEX_NONE || Offset + 1 + PayloadSize > InData.Num())
+        {
+            return false;
+        }
+        Offset += 1 + PayloadSize;
+        EventCount++;
+    }
+
+    Data = MoveTemp(InData);
+    NumEvents = EventCount;
+    return true;
+}
+
+bool FScrewMatchLog::SaveToFile(const FString& FileName) const
+{
+    return FFileHelper::SaveArrayToFile(Data, *FileName);
+}
+
+bool FScrewMatchLog::LoadFromFile(const FString& FileName)
+{
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *FileName))
+    {
+        return false;
+    }
+
+    return SetData(MoveTemp(FileData));
+}
+
+EScrewReplayResult FScrewMatchReplay::Replay(const FScrewMatchLog& Log, FScrewMatchState& OutState, int32 StopAtTurn, int32& OutEventIndex)
+{
+    const TArray<uint8>& Data = Log.GetData();
+    int32 Offset = FScrewMatchLog::HeaderSize;
+    OutEventIndex = INDEX_NONE;
+
+    FScrewAbilityCommand AbilityCommand;
+    TArray<FScrewCardReveal> Reveals;
+
+    while (Offset < Data.Num())
+    {
+        const uint8 Type = Data[Offset];
+        const int32 PayloadSize = ScrewMatchLog::GetPayloadSize(Type);
+        if (PayloadSize == INDEX_NONE || Offset + 1 + PayloadSize > Data.Num())
+        {
+            OutEventIndex++;
+            return EScrewReplayResult::Corrupt;
+        }
+
+        const uint8* Payload = Data.GetData() + Offset + 1;
+        Offset += 1 + PayloadSize;
+        OutEventIndex++;
+
+        bool bMatches = true;
+        switch (static_cast<EScrewMatchEvent>(Type))
+        {
+        case EScrewMatchEvent::MatchStart:
+            OutState.BeginMatch(ScrewMatchLog::ReadInt32(Payload));
+            break;
+        case EScrewMatchEvent::InitializeDeck:
+            OutState.InitializeDeck();
+            break;
+        case EScrewMatchEvent::ShuffleDeck:
+            OutState.ShuffleDeck();
+            break;
+        case EScrewMatchEvent::ResetSeats:
+            OutState.ResetSeats(Payload[0]);
+            break;
+        case EScrewMatchEvent::Deal:
+            bMatches = OutState.DealToSeat(Payload[0], Payload[1]) == EScrewRuleResult::Ok;
+            break;
+        case EScrewMatchEvent::Draw:
+        {
+            FScrewCardId CardId = ScrewInvalidCardId;
+            bMatches = OutState.DrawCard(Payload[0], CardId) == EScrewRuleResult::Ok && CardId == ScrewMatchLog::ReadUInt16(Payload + 1);
+            break;
+        }
+        case EScrewMatchEvent::Grant:
+            bMatches = OutState.GrantCard(Payload[0], ScrewMatchLog::ReadUInt16(Payload + 1)) == EScrewRuleResult::Ok;
+            break;
+        case EScrewMatchEvent::Play:
+        {
+            FScrewCardId CardId = ScrewInvalidCardId;
+            bMatches = OutState.PlayCard(Payload[0], Payload[1], CardId) == EScrewRuleResult::Ok && CardId == ScrewMatchLog::ReadUInt16(Payload + 2);
+            break;
+        }
+        case EScrewMatchEvent::Ability:
+        {
+            // Abilities are queued by the preceding Play event, the record only confirms it
+            const TArray<FScrewPendingAbility>& Pending = OutState.GetPendingAbilities();
+            bMatches = Pending.Num() > 0 && Pending.Last().Seat == Payload[0] && Pending.Last().Ability == static_cast<ECardAbility>(Payload[1]);
+            break;
+        }
+        case EScrewMatchEvent::AdvanceTurn:
+            bMatches = OutState.AdvanceTurn() == EScrewRuleResult::Ok && OutState.GetCurrentTurnSeat() == Payload[0];
+            if (bMatches && StopAtTurn != INDEX_NONE && OutState.GetTurnCount() >= StopAtTurn)
+            {
+                return EScrewReplayResult::Ok;
+            }
+            break;
+        case EScrewMatchEvent::AbilityTarget:
+        {
+            FScrewCardSlot& Target = AbilityCommand.Targets.AddDefaulted_GetRef();
+            Target.Seat = Payload[0];
+            Target.CardIndex = Payload[1];
+            break;
+        }
+        case EScrewMatchEvent::ResolveAbility:
+            AbilityCommand.Seat = Payload[0];
+            AbilityCommand.Ability = static_cast<ECardAbility>(Payload[1]);
+            bMatches = OutState.ResolveAbility(AbilityCommand, Reveals) == EScrewRuleResult::Ok;
+            AbilityCommand.Targets.Reset();
+            Reveals.Reset();
+            break;
+        case EScrewMatchEvent::SeatVacated:
+            bMatches = OutState.SetSeatVacant(Payload[0]) == EScrewRuleResult::Ok;
+            break;
+        }
+
+        if (!bMatches)
+        {
+            return EScrewReplayResult::Desync;
+        }
+    }
+
+    return (StopAtTurn == INDEX_NONE || OutState.GetTurnCount() >= StopAtTurn) ? EScrewReplayResult::Ok : EScrewReplayResult::TurnNotReached;
+}
@@ -0,0 +1,403 @@
+#include "ScrewMatchState.h"
+
+FScrewMatchState::FScrewMatchState()
+    : CurrentTurnSeat(INDEX_NONE)
+    , TurnCount(0)
+{
+}
+
+void FScrewMatchState::SetCatalog(const TSharedPtr<const FScrewCardCatalog>& InCatalog)
+{
+    Catalog = InCatalog;
+
+    if (Catalog.IsValid())
+    {
+        // A regenerated deck then never has to grow
+        Deck.Reserve(Catalog->GetDeckTemplate().Num());
+        DiscardPile.Reserve(Catalog->GetDeckTemplate().Num());
+    }
+}
+
+void FScrewMatchState::SetSeed(int32 InSeed)
+{
+    RandomStream.Initialize(InSeed);
+}
+
+void FScrewMatchState::BeginMatch(int32 InSeed)
+{
+    SetSeed(InSeed);
+    Deck.Reset();
+    ResetSeats(0);
+}
+
+void FScrewMatchState::InitializeDeck()
+{
+    if (Catalog.IsValid())
+    {
+        Deck.Append(Catalog->GetDeckTemplate());
+    }
+}
+
+bool FScrewMatchState::ShuffleDeck()
+{
+    if (Deck.Num() == 0)
+    {
+        return false;
+    }
+
+    for (int32 i = Deck.Num() - 1; i > 0; i--)
+    {
+        int32 SwapIndex = RandomStream.RandRange(0, i);
+        Deck.Swap(i, SwapIndex);
+    }
+
+    return true;
+}
+
+void FScrewMatchState::ResetSeats(int32 NumSeats)
+{
+    Seats.Reset();
+    Seats.SetNum(FMath::Max(NumSeats, 0));
+    DiscardPile.Reset();
+    PendingAbilities.Reset();
+    CurrentTurnSeat = INDEX_NONE;
+    TurnCount = 0;
+}
+
+EScrewRuleResult FScrewMatchState::DealToSeat(int32 Seat, int32 Count)
+{
+    if (!IsValidSeat(Seat))
+    {
+        return EScrewRuleResult::InvalidSeat;
+    }
+
+    if (Deck.Num() < Count)
+    {
+        return EScrewRuleResult::NotEnoughCards;
+    }
+
+    TArray<FScrewCardId>& Hand = Seats[Seat].Hand;
+    for (int32 i = 0; i < Count; i++)
+    {
+        Hand.Add(Deck.Pop(EAllowShrinking::No));
+    }
+
+    return EScrewRuleResult::Ok;
+}
+
+EScrewRuleResult FScrewMatchState::DrawCard(int32 Seat, FScrewCardId& OutCardId)
+{
+    if (!IsValidSeat(Seat))
+    {
+        return EScrewRuleResult::InvalidSeat;
+    }
+
+    if (Deck.Num() == 0)
+    {
+        InitializeDeck();
+        ShuffleDeck();
+
+        if (Deck.Num() == 0)
+        {
+            return EScrewRuleResult::DeckEmpty;
+        }
+    }
+
+    OutCardId = Deck.Pop(EAllowShrinking::No);
+    Seats[Seat].Hand.Add(OutCardId);
+
+    return EScrewRuleResult::Ok;
+}
+
+EScrewRuleResult FScrewMatchState::GrantCard(int32 Seat, FScrewCardId CardId)
+{
+    if (!IsValidSeat(Seat))
+    {
+        return EScrewRuleResult::InvalidSeat;
+    }
+
+    if (!Catalog.IsValid() || !Catalog->IsValidId(CardId))
+    {
+        return EScrewRuleResult::InvalidCard;
+    }
+
+    Seats[Seat].Hand.Add(CardId);
+    return EScrewRuleResult::Ok;
+}
+
+EScrewRuleResult FScrewMatchState::PlayCard(int32 Seat, int32 CardIndex, FScrewCardId& OutCardId)
+{
+    if (!IsValidSeat(Seat))
+    {
+        return EScrewRuleResult::InvalidSeat;
+    }
+
+    TArray<FScrewCardId>& Hand = Seats[Seat].Hand;
+    if (!Hand.IsValidIndex(CardIndex))
+    {
+        return EScrewRuleResult::InvalidCardIndex;
+    }
+
+    // The catalog decides whether the play queues an ability, so it has to exist before the hand is touched
+    if (!Catalog.IsValid())
+    {
+        return EScrewRuleResult::InvalidCard;
+    }
+
+    OutCardId = Hand[CardIndex];
+    Hand.RemoveAt(CardIndex, 1, EAllowShrinking::No);
+    DiscardPile.Add(OutCardId);
+
+    const ECardAbility Ability = Catalog->GetAbility(OutCardId);
+    if (Ability != ECardAbility::None)
+    {
+        FScrewPendingAbility& Pending = PendingAbilities.AddDefaulted_GetRef();
+        Pending.Seat = Seat;
+        Pending.Ability = Ability;
+    }
+
+    return EScrewRuleResult::Ok;
+}
+
+EScrewRuleResult FScrewMatchState::AdvanceTurn()
+{
+    if (Seats.Num() == 0)
+    {
+        return EScrewRuleResult::NoPlayers;
+    }
+
+    for (int32 Step = 1; Step <= Seats.Num(); Step++)
+    {
+        const int32 Seat = (CurrentTurnSeat + Step) % Seats.Num();
+        if (!Seats[Seat].bVacant)
+        {
+            TurnCount++;
+            CurrentTurnSeat = Seat;
+            return EScrewRuleResult::Ok;
+        }
+    }
+
+    return EScrewRuleResult::NoPlayers;
+}
+
+EScrewRuleResult FScrewMatchState::SetSeatVacant(int32 Seat)
+{
+    if (!IsValidSeat(Seat))
+    {
+        return EScrewRuleResult::InvalidSeat;
+    }
+
+    Seats[Seat].bVacant = true;
+    return EScrewRuleResult::Ok;
+}
+
+void FScrewMatchState::Determinize(TConstArrayView<FScrewCardSlot> KnownSlots, FRandomStream& Stream)
+{
+    auto IsKnown = [KnownSlots](int32 Seat, int32 CardIndex)
+    {
+        FScrewCardSlot Slot;
+        Slot.Seat = Seat;
+        Slot.CardIndex = CardIndex;
+        return KnownSlots.Contains(Slot);
+    };
+
+    TArray<FScrewCardId> Hidden(Deck);
+    for (int32 Seat = 0; Seat < Seats.Num(); Seat++)
+    {
+        const TArray<FScrewCardId>& Hand = Seats[Seat].Hand;
+        for (int32 CardIndex = 0; CardIndex < Hand.Num(); CardIndex++)
+        {
+            if (!IsKnown(Seat, CardIndex))
+            {
+                Hidden.Add(Hand[CardIndex]);
+            }
+        }
+    }
+
+    for (int32 i = Hidden.Num() - 1; i > 0; i--)
+    {
+        Hidden.Swap(i, Stream.RandRange(0, i));
+    }
+
+    int32 Next = 0;
+    for (FScrewCardId& CardId : Deck)
+    {
+        CardId = Hidden[Next++];
+    }
+    for (int32 Seat = 0; Seat < Seats.Num(); Seat++)
+    {
+        TArray<FScrewCardId>& Hand = Seats[Seat].Hand;
+        for (int32 CardIndex = 0; CardIndex < Hand.Num(); CardIndex++)
+        {
+            if (!IsKnown(Seat, CardIndex))
+            {
+                Hand[CardIndex] = Hidden[Next++];
+            }
+        }
+    }
+}
+
+int32 FScrewMatchState::FindPendingAbility(int32 Seat, ECardAbility Ability) const
+{
+    return PendingAbilities.IndexOfByPredicate([Seat, Ability](const FScrewPendingAbility& Pending)
+    {
+        return Pending.Seat == Seat && Pending.Ability == Ability;
+    });
+}
+
+EScrewRuleResult FScrewMatchState::ValidateAbility(const FScrewAbilityCommand& Command) const
+{
+    if (!IsValidSeat(Command.Seat))
+    {
+        return EScrewRuleResult::InvalidSeat;
+    }
+
+    if (FindPendingAbility(Command.Seat, Command.Ability) == INDEX_NONE)
+    {
+        return EScrewRuleResult::NoPendingAbility;
+    }
+
+    const TArray<FScrewCardSlot, TInlineAllocator<4>>& Targets = Command.Targets;
+    if (Targets.Num() == 0)
+    {
+        return EScrewRuleResult::Ok;
+    }
+
+    for (const FScrewCardSlot& Target : Targets)
+    {
+        if (!IsValidSlot(Target))
+        {
+            return EScrewRuleResult::InvalidTarget;
+        }
+    }
+
+    const bool bValid = [&]()
+    {
+        switch (Command.Ability)
+        {
+        case ECardAbility::Selection:
+            return Targets.Num() == 1;
+        case ECardAbility::RevealOpponentOne:
+            return Targets.Num() == 1 && Targets[0].Seat != Command.Seat;
+        case ECardAbility::RevealSelfOne:
+        case ECardAbility::DiscardOneSelf:
+            return Targets.Num() == 1 && Targets[0].Seat == Command.Seat;
+        case ECardAbility::SwapOneNoReveal:
+        case ECardAbility::RevealOneAndSwap:
+            return Targets.Num() == 2 && Targets[0].Seat == Command.Seat && Targets[1].Seat != Command.Seat;
+        case ECardAbility::RevealOneEachOpponent:
+        {
+            int32 OpponentsWithCards = 0;
+            for (int32 Seat = 0; Seat < Seats.Num(); Seat++)
+            {
+                OpponentsWithCards += (Seat != Command.Seat && Seats[Seat].Hand.Num() > 0) ? 1 : 0;
+            }
+
+            if (Targets.Num() != OpponentsWithCards)
+            {
+                return false;
+            }
+
+            for (int32 i = 0; i < Targets.Num(); i++)
+            {
+                if (Targets[i].Seat == Command.Seat)
+                {
+                    return false;
+                }
+                for (int32 j = i + 1; j < Targets.Num(); j++)
+                {
+                    if (Targets[i].Seat == Targets[j].Seat)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+        }
+    }();
+
+    return bValid ? EScrewRuleResult::Ok : EScrewRuleResult::InvalidTarget;
+}
+
+EScrewRuleResult FScrewMatchState::ResolveAbility(const FScrewAbilityCommand& Command, TArray<FScrewCardReveal>& OutReveals)
+{
+    const EScrewRuleResult Result = ValidateAbility(Command);
+    if (Result != EScrewRuleResult::Ok)
+    {
+        return Result;
+    }
+
+    PendingAbilities.RemoveAt(FindPendingAbility(Command.Seat, Command.Ability), 1, EAllowShrinking::No);
+
+    if (Command.Targets.Num() == 0)
+    {
+        return EScrewRuleResult::Ok;
+    }
+
+    auto Reveal = [this, &Command, &OutReveals](const FScrewCardSlot& Slot)
+    {
+        FScrewCardReveal& Revealed = OutReveals.AddDefaulted_GetRef();
+        Revealed.ViewerSeat = Command.Seat;
+        Revealed.Slot = Slot;
+        Revealed.CardId = Seats[Slot.Seat].Hand[Slot.CardIndex];
+    };
+
+    const FScrewCardSlot& First = Command.Targets[0];
+    switch (Command.Ability)
+    {
+    case ECardAbility::Selection:
+    case ECardAbility::RevealOpponentOne:
+    case ECardAbility::RevealSelfOne:
+    case ECardAbility::RevealOneEachOpponent:
+        for (const FScrewCardSlot& Target : Command.Targets)
+        {
+            Reveal(Target);
+        }
+        break;
+    case ECardAbility::RevealOneAndSwap:
+        Reveal(Command.Targets[1]);
+        [[fallthrough]];
+    case ECardAbility::SwapOneNoReveal:
+    {
+        const FScrewCardSlot& Second = Command.Targets[1];
+        Swap(Seats[First.Seat].Hand[First.CardIndex], Seats[Second.Seat].Hand[Second.CardIndex]);
+        break;
+    }
+    case ECardAbility::DiscardOneSelf:
+        DiscardPile.Add(Seats[First.Seat].Hand[First.CardIndex]);
+        Seats[First.Seat].Hand.RemoveAt(First.CardIndex, 1, EAllowShrinking::No);
+        break;
+    default:
+        break;
+    }
+
+    return EScrewRuleResult::Ok;
+}
+
+bool FScrewMatchState::PopPendingAbility(FScrewPendingAbility& OutAbility)
+{
+    if (PendingAbilities.Num() == 0)
+    {
+        return false;
+    }
+
+    OutAbility = PendingAbilities[0];
+    PendingAbilities.RemoveAt(0, 1, EAllowShrinking::No);
+    return true;
+}
+
+int32 FScrewMatchState::GetHandValue(int32 Seat) const
+{
+    int32 Total = 0;
+    if (IsValidSeat(Seat) && Catalog.IsValid())
+    {
+        for (const FScrewCardId CardId : Seats[Seat].Hand)
+        {
+            Total += Catalog->GetValue(CardId);
+        }
+    }
+    return Total;
+}
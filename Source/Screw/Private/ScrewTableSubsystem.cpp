@@ -0,0 +1,153 @@
+#include "ScrewTableSubsystem.h"
+#include "ScrewCardCatalog.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Controller.h"
+
+void UScrewTableSubsystem::Deinitialize()
+{
+    Tables.Empty();
+    PlayerTables.Empty();
+    Catalogs.Empty();
+
+    Super::Deinitialize();
+}
+
+void FScrewTable::CompactSeats()
+{
+    Players.RemoveAll([](const TWeakObjectPtr<AController>& Player)
+    {
+        return !Player.IsValid();
+    });
+}
+
+TSharedPtr<const FScrewCardCatalog> UScrewTableSubsystem::GetCatalog(UDataTable* CardDataTable)
+{
+    if (!CardDataTable)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<const FScrewCardCatalog>& Catalog = Catalogs.FindOrAdd(CardDataTable);
+    if (!Catalog.IsValid())
+    {
+        Catalog = FScrewCardCatalog::Build(CardDataTable);
+    }
+    return Catalog;
+}
+
+int32 UScrewTableSubsystem::CreateTable(UDataTable* CardDataTable, int32 Seed)
+{
+    TSharedPtr<const FScrewCardCatalog> Catalog = GetCatalog(CardDataTable);
+    if (!Catalog.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("ScrewTableSubsystem: Cannot create a table without a card Data Table!"));
+        return INDEX_NONE;
+    }
+
+    const int32 TableId = NextTableId++;
+    FScrewTable& Table = Tables.Add(TableId);
+
+    // The deck is built by the bound ACardManager when each match starts, so every rematch deals from a full deck
+    Table.State.SetCatalog(Catalog);
+    Table.Seed = Seed;
+
+    UE_LOG(LogTemp, Log, TEXT("ScrewTableSubsystem: Created table %d with seed %d (%d tables hosted)."), TableId, Seed, Tables.Num());
+    return TableId;
+}
+
+void UScrewTableSubsystem::DestroyTable(int32 TableId)
+{
+    FScrewTable Table;
+    if (!Tables.RemoveAndCopyValue(TableId, Table))
+    {
+        return;
+    }
+
+    for (const TWeakObjectPtr<AController>& Player : Table.Players)
+    {
+        PlayerTables.Remove(Player);
+    }
+}
+
+bool UScrewTableSubsystem::AddPlayerToTable(int32 TableId, AController* Player)
+{
+    FScrewTable* Table = Tables.Find(TableId);
+    if (!Table || !IsValid(Player))
+    {
+        return false;
+    }
+
+    if (const int32* CurrentTable = PlayerTables.Find(Player))
+    {
+        if (*CurrentTable == TableId)
+        {
+            return true;
+        }
+        RemovePlayer(Player);
+    }
+
+    // A cleared slot can only be taken once its seat is not part of the running match
+    int32 Seat = Table->Players.IndexOfByPredicate([](const TWeakObjectPtr<AController>& Seated) { return !Seated.IsValid(); });
+    if (Seat == INDEX_NONE || Table->State.IsValidSeat(Seat))
+    {
+        Table->Players.Add(Player);
+    }
+    else
+    {
+        Table->Players[Seat] = Player;
+    }
+    PlayerTables.Add(Player, TableId);
+    return true;
+}
+
+void UScrewTableSubsystem::RemovePlayer(AController* Player)
+{
+    int32 TableId = INDEX_NONE;
+    if (!PlayerTables.RemoveAndCopyValue(Player, TableId))
+    {
+        return;
+    }
+
+    // Clear the slot rather than removing it, every later player keeps their seat, hand and turn
+    if (FScrewTable* Table = Tables.Find(TableId))
+    {
+        const int32 Seat = Table->Players.IndexOfByKey(TWeakObjectPtr<AController>(Player));
+        if (Seat != INDEX_NONE)
+        {
+            Table->Players[Seat].Reset();
+            OnTablePlayerRemoved.Broadcast(TableId, Player, Seat);
+        }
+    }
+}
+
+int32 UScrewTableSubsystem::GetTableForPlayer(AController* Player) const
+{
+    const int32* TableId = PlayerTables.Find(Player);
+    return TableId ? *TableId : INDEX_NONE;
+}
+
+TArray<AController*> UScrewTableSubsystem::GetTablePlayers(int32 TableId) const
+{
+    TArray<AController*> Players;
+    if (const FScrewTable* Table = Tables.Find(TableId))
+    {
+        for (const TWeakObjectPtr<AController>& Player : Table->Players)
+        {
+            if (AController* Controller = Player.Get())
+            {
+                Players.Add(Controller);
+            }
+        }
+    }
+    return Players;
+}
+
+const FScrewTable* UScrewTableSubsystem::FindTable(int32 TableId) const
+{
+    return Tables.Find(TableId);
+}
+
+FScrewTable* UScrewTableSubsystem::FindTable(int32 TableId)
+{
+    return Tables.Find(TableId);
+}
@@ -0,0 +1,63 @@
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "CardManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewCardAtlasValueTest, "Screw.CardManager.AtlasValues", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewCardAtlasValueTest::RunTest(const FString& Parameters)
+{
+    TestEqual(TEXT("Hidden card shows the back"), ACardManager::GetCardAtlasValue(INDEX_NONE, 0), 0.f);
+    TestEqual(TEXT("Card 0 does not share the back tile"), ACardManager::GetCardAtlasValue(0, 0), 1.f);
+    TestEqual(TEXT("Faces follow the back"), ACardManager::GetCardAtlasValue(12, 0), 13.f);
+    TestEqual(TEXT("Moved back keeps faces after it"), ACardManager::GetCardAtlasValue(0, 40), 41.f);
+    TestEqual(TEXT("Moved back is used for hidden cards"), ACardManager::GetCardAtlasValue(INDEX_NONE, 40), 40.f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewRemoteCardInstancesTest, "Screw.CardManager.RemoteCardInstances", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewRemoteCardInstancesTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    ACardManager* CardManager = World->SpawnActor<ACardManager>();
+    if (!TestNotNull(TEXT("Card manager spawned"), CardManager))
+    {
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    // Two seats as a client receives them: hand sizes and seat transforms, no card actors
+    CardManager->bUseInstancedRendering = true;
+    CardManager->CardBackAtlasIndex = 0;
+    const TArray<FTransform> SeatTransforms = { FTransform::Identity, FTransform(FRotator(0.f, 180.f, 0.f), FVector(500.f, 0.f, 0.f)) };
+
+    // The local player has peeked at its second card, which is catalog card 0
+    TArray<FScrewVisibleCard> KnownCards;
+    FScrewVisibleCard& Known = KnownCards.AddDefaulted_GetRef();
+    Known.Seat = 0;
+    Known.CardIndex = 1;
+    Known.CardId = 0;
+
+    CardManager->SetRemoteLayoutForTest({ 2, 1 }, SeatTransforms, KnownCards);
+
+    const UInstancedStaticMeshComponent* Instances = CardManager->CardInstances;
+    if (TestEqual(TEXT("One instance per card"), Instances->GetInstanceCount(), 3))
+    {
+        const int32 Stride = Instances->NumCustomDataFloats;
+        TestEqual(TEXT("Unknown own card shows the back"), Instances->PerInstanceSMCustomData[0 * Stride], 0.f);
+        TestEqual(TEXT("Known card 0 shows its face"), Instances->PerInstanceSMCustomData[1 * Stride], 1.f);
+        TestEqual(TEXT("Opponent card shows the back"), Instances->PerInstanceSMCustomData[2 * Stride], 0.f);
+    }
+
+    // A played card shrinks the hand, the instance goes away with it
+    CardManager->SetRemoteLayoutForTest({ 1, 1 }, SeatTransforms, TArray<FScrewVisibleCard>());
+    TestEqual(TEXT("Instances follow hand sizes"), Instances->GetInstanceCount(), 2);
+
+    World->DestroyWorld(false);
+    return true;
+}
+
+#endif
@@ -0,0 +1,104 @@
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "ScrewHandView.h"
+#include "ScrewTestListeners.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewHandViewRemovedCardsTest, "Screw.HandView.RemovedCards", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewHandViewRemovedCardsTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    AScrewHandView* View = World->SpawnActor<AScrewHandView>();
+    if (!TestNotNull(TEXT("Hand view spawned"), View))
+    {
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    UScrewHandViewTestListener* Listener = NewObject<UScrewHandViewTestListener>();
+    Listener->Bind(View);
+
+    // Stand in for the client copy of the view's array, the callbacks are what the fast array serializer calls on receive
+    FScrewKnownCardArray ClientCards;
+    ClientCards.View = View;
+
+    // Both references are held across the second add, the array must not reallocate in between
+    ClientCards.Items.Reserve(2);
+    FScrewKnownCard& Kept = ClientCards.Items.AddDefaulted_GetRef();
+    Kept.Seat = 0;
+    Kept.CardIndex = 0;
+    Kept.CardId = 7;
+
+    FScrewKnownCard& Played = ClientCards.Items.AddDefaulted_GetRef();
+    Played.Seat = 1;
+    Played.CardIndex = 2;
+    Played.CardId = 3;
+
+    // The played card leaves the view while the kept slot changes face in the same update
+    Played.PreReplicatedRemove(ClientCards);
+    Kept.CardId = 9;
+    Kept.PostReplicatedChange(ClientCards);
+    ClientCards.PostReplicatedReceive(FFastArraySerializer::FPostReplicatedReceiveParameters{});
+
+    if (TestEqual(TEXT("One removal broadcast"), Listener->Removed.Num(), 1))
+    {
+        TestEqual(TEXT("Removed seat"), Listener->Removed[0].Seat, 1);
+        TestEqual(TEXT("Removed card index"), Listener->Removed[0].CardIndex, 2);
+        TestEqual(TEXT("Removed card id"), Listener->Removed[0].CardId, 3);
+    }
+    if (TestEqual(TEXT("One change broadcast"), Listener->Changed.Num(), 1))
+    {
+        TestEqual(TEXT("Changed card id"), Listener->Changed[0].CardId, 9);
+    }
+
+    // Nothing is pending after the broadcast, a later update must not repeat the removal
+    Listener->Removed.Reset();
+    ClientCards.PostReplicatedReceive(FFastArraySerializer::FPostReplicatedReceiveParameters{});
+    TestEqual(TEXT("Removal is broadcast once"), Listener->Removed.Num(), 0);
+
+    World->DestroyWorld(false);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewHandViewServerRemovalTest, "Screw.HandView.ServerRemovesStaleSlots", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewHandViewServerRemovalTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    AScrewHandView* View = World->SpawnActor<AScrewHandView>();
+    if (!TestNotNull(TEXT("Hand view spawned"), View))
+    {
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    FScrewCardReveal Reveals[2];
+    Reveals[0].ViewerSeat = 0;
+    Reveals[0].Slot.Seat = 0;
+    Reveals[0].Slot.CardIndex = 1;
+    Reveals[0].CardId = 4;
+    Reveals[1].ViewerSeat = 0;
+    Reveals[1].Slot.Seat = 1;
+    Reveals[1].Slot.CardIndex = 0;
+    Reveals[1].CardId = 5;
+
+    View->SetKnownCards(0, Reveals);
+    TestEqual(TEXT("Both reveals are visible"), View->GetKnownCards().Num(), 2);
+
+    // The opponent card was swapped away, only the own peek stays visible
+    View->SetKnownCards(0, MakeArrayView(Reveals, 1));
+    const TArray<FScrewVisibleCard> Visible = View->GetKnownCards();
+    if (TestEqual(TEXT("Stale reveal removed"), Visible.Num(), 1))
+    {
+        TestEqual(TEXT("Remaining slot"), Visible[0].CardIndex, 1);
+        TestEqual(TEXT("Remaining card id"), Visible[0].CardId, 4);
+    }
+
+    World->DestroyWorld(false);
+    return true;
+}
+
+#endif
@@ -0,0 +1,432 @@
+#include "Misc/AutomationTest.h"
+#include "ScrewMatchState.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ScrewMatchStateTests
+{
+    /** Small catalog with one plain card and one card per ability the tests resolve, 12 cards per deck */
+    TSharedPtr<const FScrewCardCatalog> MakeCatalog()
+    {
+        auto MakeRow = [](const TCHAR* Name, int32 Value, ECardAbility Ability, int32 Quantity)
+        {
+            FCardData Row;
+            Row.Name = Name;
+            Row.Value = Value;
+            Row.Ability = Ability;
+            Row.Quantity = Quantity;
+            return Row;
+        };
+
+        TArray<FCardData> Rows;
+        Rows.Add(MakeRow(TEXT("Plain"), 1, ECardAbility::None, 6));
+        Rows.Add(MakeRow(TEXT("Peek"), 2, ECardAbility::RevealSelfOne, 2));
+        Rows.Add(MakeRow(TEXT("Discard"), 10, ECardAbility::DiscardOneSelf, 2));
+        Rows.Add(MakeRow(TEXT("Swap"), 3, ECardAbility::SwapOneNoReveal, 2));
+        return MakeShared<FScrewCardCatalog>(Rows);
+    }
+
+    /** Copies of every card id held by the deck, all hands and the discard pile together */
+    TArray<int32> CountCards(const FScrewMatchState& State)
+    {
+        TArray<int32> Counts;
+        Counts.SetNumZeroed(State.GetCatalog()->Num());
+
+        auto Add = [&Counts](const TArray<FScrewCardId>& Cards)
+        {
+            for (const FScrewCardId CardId : Cards)
+            {
+                Counts[CardId]++;
+            }
+        };
+
+        Add(State.GetDeck());
+        Add(State.GetDiscardPile());
+        for (int32 Seat = 0; Seat < State.GetNumSeats(); Seat++)
+        {
+            Add(State.GetHand(Seat));
+        }
+        return Counts;
+    }
+
+    /** Picks random legal targets for a pending ability, or declines it when there are none */
+    FScrewAbilityCommand MakeRandomCommand(const FScrewMatchState& State, const FScrewPendingAbility& Pending, FRandomStream& Stream)
+    {
+        FScrewAbilityCommand Command;
+        Command.Seat = Pending.Seat;
+        Command.Ability = Pending.Ability;
+
+        const int32 OwnCards = State.GetHand(Pending.Seat).Num();
+        if (OwnCards == 0 || Stream.RandRange(0, 3) == 0)
+        {
+            return Command;
+        }
+
+        FScrewCardSlot& Own = Command.Targets.AddDefaulted_GetRef();
+        Own.Seat = Pending.Seat;
+        Own.CardIndex = Stream.RandRange(0, OwnCards - 1);
+
+        if (Pending.Ability == ECardAbility::SwapOneNoReveal)
+        {
+            TArray<int32, TInlineAllocator<4>> Opponents;
+            for (int32 Seat = 0; Seat < State.GetNumSeats(); Seat++)
+            {
+                if (Seat != Pending.Seat && State.GetHand(Seat).Num() > 0)
+                {
+                    Opponents.Add(Seat);
+                }
+            }
+
+            if (Opponents.Num() == 0)
+            {
+                Command.Targets.Reset();
+                return Command;
+            }
+
+            FScrewCardSlot& Other = Command.Targets.AddDefaulted_GetRef();
+            Other.Seat = Opponents[Stream.RandRange(0, Opponents.Num() - 1)];
+            Other.CardIndex = Stream.RandRange(0, State.GetHand(Other.Seat).Num() - 1);
+        }
+        return Command;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStateDealTest, "Screw.MatchState.Deal", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStateDealTest::RunTest(const FString& Parameters)
+{
+    FScrewMatchState State;
+    State.SetCatalog(ScrewMatchStateTests::MakeCatalog());
+    State.SetSeed(1);
+    State.InitializeDeck();
+    TestTrue(TEXT("Full deck shuffles"), State.ShuffleDeck());
+    State.ResetSeats(2);
+
+    TestEqual(TEXT("Deal to seat 0"), State.DealToSeat(0, 4), EScrewRuleResult::Ok);
+    TestEqual(TEXT("Dealt hand size"), State.GetHand(0).Num(), 4);
+    TestEqual(TEXT("Deck shrinks by the deal"), State.GetDeckNum(), 8);
+
+    TestEqual(TEXT("Deal past the last seat"), State.DealToSeat(2, 1), EScrewRuleResult::InvalidSeat);
+    TestEqual(TEXT("Deal more than the deck holds"), State.DealToSeat(1, 9), EScrewRuleResult::NotEnoughCards);
+    TestEqual(TEXT("Failed deal leaves the hand empty"), State.GetHand(1).Num(), 0);
+    TestEqual(TEXT("Failed deal leaves the deck alone"), State.GetDeckNum(), 8);
+
+    // The same seed deals the same cards
+    FScrewMatchState Again;
+    Again.SetCatalog(ScrewMatchStateTests::MakeCatalog());
+    Again.SetSeed(1);
+    Again.InitializeDeck();
+    Again.ShuffleDeck();
+    Again.ResetSeats(2);
+    Again.DealToSeat(0, 4);
+    TestEqual(TEXT("Seeded deal is reproducible"), Again.GetHand(0), State.GetHand(0));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStateRematchTest, "Screw.MatchState.Rematch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStateRematchTest::RunTest(const FString& Parameters)
+{
+    FScrewMatchState State;
+    State.SetCatalog(ScrewMatchStateTests::MakeCatalog());
+    State.BeginMatch(3);
+    State.InitializeDeck();
+    State.ShuffleDeck();
+    State.ResetSeats(2);
+    State.DealToSeat(0, 4);
+    State.AdvanceTurn();
+
+    // The next match starts from a full deck again, not from the previous match's leftovers
+    State.BeginMatch(4);
+    TestEqual(TEXT("New match reseeds"), State.GetSeed(), 4);
+    TestEqual(TEXT("New match has no seats"), State.GetNumSeats(), 0);
+    TestEqual(TEXT("New match has no turn"), State.GetCurrentTurnSeat(), INDEX_NONE);
+    State.InitializeDeck();
+    TestEqual(TEXT("New match holds one deck"), State.GetDeckNum(), State.GetCatalog()->GetDeckTemplate().Num());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStateDrawTest, "Screw.MatchState.DrawRegeneratesDeck", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStateDrawTest::RunTest(const FString& Parameters)
+{
+    FScrewMatchState State;
+    State.SetCatalog(ScrewMatchStateTests::MakeCatalog());
+    State.SetSeed(2);
+    State.InitializeDeck();
+    State.ShuffleDeck();
+    State.ResetSeats(1);
+
+    const int32 DeckSize = State.GetDeckNum();
+    TestEqual(TEXT("Deal the whole deck"), State.DealToSeat(0, DeckSize), EScrewRuleResult::Ok);
+    TestEqual(TEXT("Deck is empty"), State.GetDeckNum(), 0);
+
+    FScrewCardId CardId = ScrewInvalidCardId;
+    TestEqual(TEXT("Draw from an invalid seat"), State.DrawCard(1, CardId), EScrewRuleResult::InvalidSeat);
+    TestEqual(TEXT("Draw from an empty deck"), State.DrawCard(0, CardId), EScrewRuleResult::Ok);
+    TestTrue(TEXT("Drawn card is a catalog card"), State.GetCatalog()->IsValidId(CardId));
+    TestEqual(TEXT("Regenerated deck lost the drawn card"), State.GetDeckNum(), DeckSize - 1);
+    TestEqual(TEXT("Drawn card lands in the hand"), State.GetHand(0).Last(), CardId);
+
+    // Without a catalog there is nothing to regenerate from
+    FScrewMatchState NoCatalog;
+    NoCatalog.ResetSeats(1);
+    TestEqual(TEXT("Draw without a catalog"), NoCatalog.DrawCard(0, CardId), EScrewRuleResult::DeckEmpty);
+    TestEqual(TEXT("Failed draw leaves the hand empty"), NoCatalog.GetHand(0).Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStatePlayTest, "Screw.MatchState.PlayQueuesAbility", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStatePlayTest::RunTest(const FString& Parameters)
+{
+    FScrewMatchState State;
+    State.SetCatalog(ScrewMatchStateTests::MakeCatalog());
+    State.ResetSeats(1);
+
+    const FScrewCardId Plain = State.GetCatalog()->FindCardId(TEXT("Plain"));
+    const FScrewCardId Peek = State.GetCatalog()->FindCardId(TEXT("Peek"));
+    State.GrantCard(0, Plain);
+    State.GrantCard(0, Peek);
+
+    FScrewCardId CardId = ScrewInvalidCardId;
+    TestEqual(TEXT("Play an invalid index"), State.PlayCard(0, 2, CardId), EScrewRuleResult::InvalidCardIndex);
+    TestEqual(TEXT("Failed play leaves the hand alone"), State.GetHand(0).Num(), 2);
+
+    TestEqual(TEXT("Play the plain card"), State.PlayCard(0, 0, CardId), EScrewRuleResult::Ok);
+    TestEqual(TEXT("Played card id"), CardId, Plain);
+    TestEqual(TEXT("Plain card queues nothing"), State.GetPendingAbilities().Num(), 0);
+
+    TestEqual(TEXT("Play the ability card"), State.PlayCard(0, 0, CardId), EScrewRuleResult::Ok);
+    if (TestEqual(TEXT("Ability card queues its ability"), State.GetPendingAbilities().Num(), 1))
+    {
+        TestEqual(TEXT("Pending seat"), State.GetPendingAbilities()[0].Seat, 0);
+        TestEqual(TEXT("Pending ability"), State.GetPendingAbilities()[0].Ability, ECardAbility::RevealSelfOne);
+    }
+
+    const TArray<FScrewCardId> Expected = { Plain, Peek };
+    TestEqual(TEXT("Both cards are discarded in play order"), State.GetDiscardPile(), Expected);
+    TestEqual(TEXT("Hand is empty"), State.GetHand(0).Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStateAdvanceTurnTest, "Screw.MatchState.AdvanceTurn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStateAdvanceTurnTest::RunTest(const FString& Parameters)
+{
+    FScrewMatchState State;
+    TestEqual(TEXT("No seats, no turn"), State.AdvanceTurn(), EScrewRuleResult::NoPlayers);
+
+    State.ResetSeats(3);
+    TestEqual(TEXT("No turn before the first advance"), State.GetCurrentTurnSeat(), INDEX_NONE);
+
+    const int32 ExpectedSeats[] = { 0, 1, 2, 0 };
+    for (const int32 Expected : ExpectedSeats)
+    {
+        TestEqual(TEXT("Advance"), State.AdvanceTurn(), EScrewRuleResult::Ok);
+        TestEqual(TEXT("Turn order wraps around the table"), State.GetCurrentTurnSeat(), Expected);
+    }
+    TestEqual(TEXT("Turn count"), State.GetTurnCount(), 4);
+
+    // A vacated seat is passed over within the same advance
+    State.SetSeatVacant(1);
+    State.AdvanceTurn();
+    TestEqual(TEXT("Vacant seat is skipped"), State.GetCurrentTurnSeat(), 2);
+    TestEqual(TEXT("Skipping costs no extra turn"), State.GetTurnCount(), 5);
+
+    State.SetSeatVacant(0);
+    State.SetSeatVacant(2);
+    TestEqual(TEXT("Every seat vacant"), State.AdvanceTurn(), EScrewRuleResult::NoPlayers);
+    TestEqual(TEXT("Failed advance keeps the turn"), State.GetCurrentTurnSeat(), 2);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStateAbilityTest, "Screw.MatchState.Abilities", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStateAbilityTest::RunTest(const FString& Parameters)
+{
+    FScrewMatchState State;
+    State.SetCatalog(ScrewMatchStateTests::MakeCatalog());
+    State.ResetSeats(2);
+
+    const FScrewCardCatalog* Catalog = State.GetCatalog();
+    const FScrewCardId Plain = Catalog->FindCardId(TEXT("Plain"));
+    const FScrewCardId Peek = Catalog->FindCardId(TEXT("Peek"));
+    const FScrewCardId Discard = Catalog->FindCardId(TEXT("Discard"));
+    const FScrewCardId Swap = Catalog->FindCardId(TEXT("Swap"));
+
+    State.GrantCard(0, Peek);
+    State.GrantCard(0, Discard);
+    State.GrantCard(0, Swap);
+    State.GrantCard(0, Plain);
+    State.GrantCard(1, Discard);
+
+    FScrewAbilityCommand Command;
+    Command.Seat = 0;
+    Command.Ability = ECardAbility::RevealSelfOne;
+    Command.Targets.Add({ 0, 0 });
+
+    TArray<FScrewCardReveal> Reveals;
+    TestEqual(TEXT("Nothing pending yet"), State.ValidateAbility(Command), EScrewRuleResult::NoPendingAbility);
+
+    // Hand is Peek, Discard, Swap, Plain; playing Peek leaves Discard, Swap, Plain
+    FScrewCardId CardId = ScrewInvalidCardId;
+    State.PlayCard(0, 0, CardId);
+
+    Command.Targets[0] = { 1, 0 };
+    TestEqual(TEXT("Reveal self on an opponent card"), State.ValidateAbility(Command), EScrewRuleResult::InvalidTarget);
+    Command.Targets[0] = { 0, 3 };
+    TestEqual(TEXT("Reveal self past the hand"), State.ValidateAbility(Command), EScrewRuleResult::InvalidTarget);
+    Command.Targets[0] = { 0, 2 };
+    TestEqual(TEXT("Reveal self on an own card"), State.ValidateAbility(Command), EScrewRuleResult::Ok);
+
+    TestEqual(TEXT("Resolve reveal"), State.ResolveAbility(Command, Reveals), EScrewRuleResult::Ok);
+    if (TestEqual(TEXT("One card revealed"), Reveals.Num(), 1))
+    {
+        TestEqual(TEXT("Revealed to the caster"), Reveals[0].ViewerSeat, 0);
+        TestEqual(TEXT("Revealed card"), Reveals[0].CardId, Plain);
+    }
+    TestEqual(TEXT("Resolving consumes the pending ability"), State.GetPendingAbilities().Num(), 0);
+    TestEqual(TEXT("Resolved twice"), State.ResolveAbility(Command, Reveals), EScrewRuleResult::NoPendingAbility);
+
+    // Hand is Swap, Plain after playing Discard; discarding Plain leaves only Swap
+    State.PlayCard(0, 0, CardId);
+    Command.Ability = ECardAbility::DiscardOneSelf;
+    Command.Targets[0] = { 0, 1 };
+    Reveals.Reset();
+    TestEqual(TEXT("Resolve discard"), State.ResolveAbility(Command, Reveals), EScrewRuleResult::Ok);
+    TestEqual(TEXT("Discard reveals nothing"), Reveals.Num(), 0);
+    TestEqual(TEXT("Discarded card leaves the hand"), State.GetHand(0).Num(), 1);
+    TestEqual(TEXT("Discarded card tops the pile"), State.GetDiscardPile().Last(), Plain);
+
+    // Hand is Swap, Plain after the grant; playing Swap leaves Plain to trade for the opponent's Discard
+    State.GrantCard(0, Plain);
+    State.PlayCard(0, 0, CardId);
+    Command.Ability = ECardAbility::SwapOneNoReveal;
+    Command.Targets.Reset();
+    Command.Targets.Add({ 0, 0 });
+    TestEqual(TEXT("Swap needs two targets"), State.ValidateAbility(Command), EScrewRuleResult::InvalidTarget);
+    Command.Targets.Add({ 0, 0 });
+    TestEqual(TEXT("Swap needs an opponent card"), State.ValidateAbility(Command), EScrewRuleResult::InvalidTarget);
+    Command.Targets[1] = { 1, 0 };
+    TestEqual(TEXT("Resolve swap"), State.ResolveAbility(Command, Reveals), EScrewRuleResult::Ok);
+    TestEqual(TEXT("Own card now holds the opponent card"), State.GetHand(0)[0], Discard);
+    TestEqual(TEXT("Opponent card now holds the own card"), State.GetHand(1)[0], Plain);
+
+    // An empty target list declines the ability and still consumes it
+    State.GrantCard(0, Peek);
+    State.PlayCard(0, 1, CardId);
+    Command.Ability = ECardAbility::RevealSelfOne;
+    Command.Targets.Reset();
+    TestEqual(TEXT("Decline"), State.ResolveAbility(Command, Reveals), EScrewRuleResult::Ok);
+    TestEqual(TEXT("Declined ability is consumed"), State.GetPendingAbilities().Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScrewMatchStateConservationTest, "Screw.MatchState.RandomPlayConservesCards", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScrewMatchStateConservationTest::RunTest(const FString& Parameters)
+{
+    using namespace ScrewMatchStateTests;
+
+    static constexpr int32 NumMatches = 16;
+    static constexpr int32 StepsPerMatch = 400;
+
+    const TSharedPtr<const FScrewCardCatalog> Catalog = MakeCatalog();
+    const int32 TemplateNum = Catalog->GetDeckTemplate().Num();
+
+    TArray<int32> TemplateCounts;
+    TemplateCounts.SetNumZeroed(Catalog->Num());
+    for (const FScrewCardId CardId : Catalog->GetDeckTemplate())
+    {
+        TemplateCounts[CardId]++;
+    }
+
+    for (int32 Match = 0; Match < NumMatches; Match++)
+    {
+        FRandomStream Stream(Match + 1);
+
+        FScrewMatchState State;
+        State.SetCatalog(Catalog);
+        State.SetSeed(Match + 1);
+        State.InitializeDeck();
+        State.ShuffleDeck();
+
+        const int32 NumSeats = Stream.RandRange(2, 4);
+        State.ResetSeats(NumSeats);
+        for (int32 Seat = 0; Seat < NumSeats; Seat++)
+        {
+            State.DealToSeat(Seat, 2);
+        }
+        State.AdvanceTurn();
+
+        // Every regeneration of an empty deck adds one full template, nothing else may create or destroy a card
+        int32 Decks = 1;
+        for (int32 Step = 0; Step < StepsPerMatch; Step++)
+        {
+            const int32 Seat = State.GetCurrentTurnSeat();
+            EScrewRuleResult Result = EScrewRuleResult::Ok;
+
+            if (State.GetPendingAbilities().Num() > 0)
+            {
+                TArray<FScrewCardReveal> Reveals;
+                Result = State.ResolveAbility(MakeRandomCommand(State, State.GetPendingAbilities()[0], Stream), Reveals);
+            }
+            else
+            {
+                switch (Stream.RandRange(0, 2))
+                {
+                case 0:
+                {
+                    Decks += (State.GetDeckNum() == 0) ? 1 : 0;
+                    FScrewCardId CardId = ScrewInvalidCardId;
+                    Result = State.DrawCard(Seat, CardId);
+                    break;
+                }
+                case 1:
+                {
+                    const int32 HandNum = State.GetHand(Seat).Num();
+                    if (HandNum > 0)
+                    {
+                        FScrewCardId CardId = ScrewInvalidCardId;
+                        Result = State.PlayCard(Seat, Stream.RandRange(0, HandNum - 1), CardId);
+                    }
+                    break;
+                }
+                default:
+                    Result = State.AdvanceTurn();
+                    break;
+                }
+            }
+
+            if (!TestEqual(FString::Printf(TEXT("Match %d step %d is legal"), Match, Step), Result, EScrewRuleResult::Ok))
+            {
+                return false;
+            }
+
+            const TArray<int32> Counts = CountCards(State);
+            for (int32 CardId = 0; CardId < Counts.Num(); CardId++)
+            {
+                if (!TestEqual(FString::Printf(TEXT("Match %d step %d holds every copy of card %d"), Match, Step, CardId), Counts[CardId], TemplateCounts[CardId] * Decks))
+                {
+                    return false;
+                }
+            }
+        }
+
+        const int32 Total = State.GetDeckNum() + State.GetDiscardPile().Num() + [&State]()
+        {
+            int32 InHands = 0;
+            for (int32 Seat = 0; Seat < State.GetNumSeats(); Seat++)
+            {
+                InHands += State.GetHand(Seat).Num();
+            }
+            return InHands;
+        }();
+        TestEqual(FString::Printf(TEXT("Match %d deck + hands + discard"), Match), Total, TemplateNum * Decks);
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "ScrewHandView.h"
+#include "ScrewTestListeners.generated.h"
+
+/** Records the broadcasts of an AScrewHandView so automation tests can inspect them */
+UCLASS(Transient)
+class UScrewHandViewTestListener : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void Bind(AScrewHandView* View)
+    {
+        View->OnKnownCardsChanged.AddDynamic(this, &UScrewHandViewTestListener::HandleChanged);
+        View->OnKnownCardsRemoved.AddDynamic(this, &UScrewHandViewTestListener::HandleRemoved);
+    }
+
+    UFUNCTION()
+    void HandleChanged(const TArray<FScrewVisibleCard>& Cards) { Changed.Append(Cards); }
+
+    UFUNCTION()
+    void HandleRemoved(const TArray<FScrewVisibleCard>& Cards) { Removed.Append(Cards); }
+
+    TArray<FScrewVisibleCard> Changed;
+    TArray<FScrewVisibleCard> Removed;
+};
@@ -66,10 +66,18 @@ protected:
     virtual void BeginPlay() override;
 
 public:
-    /** Initialize the card with specific data */
+    /** Initialize the card with specific data, activating it if it was sitting in a pool */
     UFUNCTION(BlueprintCallable, Category = "Card")
     void InitializeCard(const FCardData& NewCardData);
 
+    /** Clears the card data and hides the card so it can be reused by a card pool */
+    UFUNCTION(BlueprintCallable, Category = "Card")
+    void ReleaseCard();
+
+    /** True while the card is initialized and in play, false while it is parked in a pool */
+    UFUNCTION(BlueprintPure, Category = "Card")
+    bool IsCardInUse() const { return bCardInUse; }
+
     /** Display card details in the log (for debugging) */
     UFUNCTION(BlueprintCallable, Category = "Card")
     void PrintCardDetails() const;
@@ -77,4 +85,11 @@ public:
     /** Card Data Struct to hold the card's information */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card", meta = (AllowPrivateAccess = "true"))
     FCardData CardData;
+
+    /** Catalog id of this card, INDEX_NONE if it was not created from the card catalog */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Card")
+    int32 CardId = INDEX_NONE;
+
+private:
+    bool bCardInUse = false;
 };
@@ -3,8 +3,18 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Card.h"
+#include "ScrewMatchState.h"
+#include "ScrewMatchLog.h"
+#include "ScrewHandView.h"
 #include "CardManager.generated.h"
 
+class AGameModeBase;
+class APlayerController;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+struct FScrewTable;
+
 /** Struct to Wrap Player Hands */
 USTRUCT(BlueprintType)
 struct FPlayerHand
@@ -17,11 +27,30 @@ struct FPlayerHand
     FPlayerHand() {}
 };
 
+/** Card in a player's hand targeted by an ability */
+USTRUCT(BlueprintType)
+struct FScrewAbilityTarget
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Card Data")
+    AController* Player = nullptr;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Card Data")
+    int32 CardIndex = INDEX_NONE;
+};
+
 UCLASS()
 class SCREW_API ACardManager : public AActor
 {
     GENERATED_BODY()
 
+    /** Bots read the match state and act through the same entry points as players */
+    friend class AScrewBotController;
+
+    /** Client hand views bind themselves as the local view once their manager replicates */
+    friend class AScrewHandView;
+
 public:
     ACardManager();
 
@@ -52,10 +81,56 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "Card Settings")
     TSubclassOf<ACard> CardClass;
 
+    /** Seed for the match random stream, 0 picks a random seed when the match starts. A bound table uses its own seed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Settings")
+    int32 MatchSeed = 0;
+
+    /** Table in the UScrewTableSubsystem this manager presents; its players, match state and log are used directly. INDEX_NONE runs a local match for every logged in player */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Card Settings")
+    int32 TableId = INDEX_NONE;
+
+    /** Extra pooled cards spawned at BeginPlay on top of one full deck */
+    UPROPERTY(EditDefaultsOnly, Category = "Card Settings")
+    int32 ExtraPooledCards = 0;
+
+    /**
+     * Draws every card through CardInstances instead of each card actor's own mesh.
+     * Card actors stay hidden and only the local player's cards keep collision for hit testing.
+     * Clients have no card actors, they lay out the instances from HandSizes, SeatTransforms and their own AScrewHandView.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Card Rendering")
+    bool bUseInstancedRendering = false;
+
+    /** Mesh drawn per card in instanced mode, authored to match the card actor's mesh placement */
+    UPROPERTY(EditDefaultsOnly, Category = "Card Rendering", meta = (EditCondition = "bUseInstancedRendering"))
+    UStaticMesh* CardInstanceMesh;
+
+    /** Atlas material reading the tile from PerInstanceCustomData[0], see GetCardAtlasValue for the layout */
+    UPROPERTY(EditDefaultsOnly, Category = "Card Rendering", meta = (EditCondition = "bUseInstancedRendering"))
+    UMaterialInterface* CardAtlasMaterial;
+
+    /** Atlas index of the card back shown for cards the local player cannot see, card faces follow right after it */
+    UPROPERTY(EditDefaultsOnly, Category = "Card Rendering", meta = (EditCondition = "bUseInstancedRendering"))
+    int32 CardBackAtlasIndex = 0;
+
+    /** Atlas tile for a card: BackAtlasIndex for a hidden card (INDEX_NONE), BackAtlasIndex + 1 + CardId for a face */
+    static float GetCardAtlasValue(int32 CardId, int32 BackAtlasIndex);
+
+    /** Single instanced mesh holding every card of this table in instanced mode */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Card Rendering")
+    UInstancedStaticMeshComponent* CardInstances;
+
+#if WITH_DEV_AUTOMATION_TESTS
+    /** Sets HandSizes and SeatTransforms as a client receives them and lays out the instances with KnownCards face up */
+    void SetRemoteLayoutForTest(const TArray<uint8>& InHandSizes, const TArray<FTransform>& InSeatTransforms, TConstArrayView<FScrewVisibleCard> KnownCards);
+#endif
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-    /** Initializes the deck with shuffled cards from the Data Table */
+    /** Starts a new match and builds its deck from the Data Table */
     UFUNCTION(BlueprintCallable, Category = "Card Management")
     void InitializeDeck();
 
@@ -98,18 +173,204 @@ protected:
 
     UFUNCTION(BlueprintCallable, Category = "Card Settings")
     ACard* GrantCardFromDeck(AController* Controller, FTransform Transform);
+
+    /** Seats a player, reusing the first vacant seat that is not part of the running match; returns the seat index */
+    UFUNCTION(BlueprintCallable, Category = "Card Management")
+    int32 RegisterPlayer(AController* Controller);
+
+    /** Vacates the player's seat for the rest of the match, the seat index stays reserved so other seats keep their index */
+    UFUNCTION(BlueprintCallable, Category = "Card Management")
+    void UnregisterPlayer(AController* Controller);
+
+    /** Returns the seat of a registered player, or INDEX_NONE */
+    UFUNCTION(BlueprintPure, Category = "Card Management")
+    int32 GetPlayerSeat(AController* Controller) const { return GetSeatIndex(Controller); }
+
+    /**
+     * Queues the resolution of an ability the player has pending from a played card.
+     * Targets are validated immediately; every ability queued in a frame is resolved together at the
+     * start of the next tick, so all of their reveals reach each viewer's AScrewHandView in one update.
+     * An empty target list declines the ability.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Card Management")
+    bool QueueAbility(AController* Controller, ECardAbility Ability, const TArray<FScrewAbilityTarget>& Targets);
+
+    /** Card faces the player is allowed to see, only replicated to that player */
+    UFUNCTION(BlueprintPure, Category = "Card Management")
+    AScrewHandView* GetHandView(AController* Controller) const;
+
+    /** Number of cards in each seat's hand, replicated to everyone so opponents can show card backs */
+    UPROPERTY(ReplicatedUsing = OnRep_HandSizes, BlueprintReadOnly, Category = "Card Management")
+    TArray<uint8> HandSizes;
+
+    UFUNCTION(BlueprintImplementableEvent, Category = "Card Management")
+    void OnHandSizesChanged();
+
+    /** Where each seat's hand is laid out, set at the deal and replicated so clients can place card backs */
+    UPROPERTY(ReplicatedUsing = OnRep_SeatTransforms, BlueprintReadOnly, Category = "Card Management")
+    TArray<FTransform> SeatTransforms;
+
+    /** Client side: binds the local player's hand view so its faces are drawn on top of the card backs */
+    void RegisterLocalHandView(AScrewHandView* View);
+
+    /** Client side: lays out one instance per card in HandSizes, showing the faces in KnownCards and the back everywhere else */
+    void UpdateRemoteCardInstances(TConstArrayView<FScrewVisibleCard> KnownCards);
+
+    /** Returns a card actor to the pool so a later deal or grant can reuse it */
+    UFUNCTION(BlueprintCallable, Category = "Card Management")
+    void ReleaseCardToPool(ACard* Card);
+
+    /** Writes the binary event log of the current match to a file */
+    UFUNCTION(BlueprintCallable, Category = "Card Management")
+    bool SaveMatchLog(const FString& FileName) const;
+
+    /**
+     * Rebuilds a recorded match up to the start of Turn (or the whole match for -1) without touching the live match.
+     * Returns false if the log cannot be loaded or does not replay cleanly; OutHandValues receives each seat's hand value.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Card Management")
+    bool ReplayMatchLog(const FString& FileName, int32 Turn, TArray<int32>& OutHandValues) const;
+
+    /** Append-only event log of the current match, the bound table's log when TableId is set */
+    const FScrewMatchLog& GetMatchLog() const;
+
+    /** Headless rules state driven by this manager, the bound table's state when TableId is set */
+    const FScrewMatchState& GetMatchState() const;
     
 private:
-    /** The deck containing card data */
+    /** Returns the seat index of the controller in the match state, or INDEX_NONE */
+    int32 GetSeatIndex(AController* Controller) const;
+
+    /** Returns the hosted table TableId refers to, or null when running a local match */
+    FScrewTable* FindBoundTable() const;
+
+    /** Match state and log every rule step goes through, so a bound table and this manager never diverge */
+    FScrewMatchState& GetActiveMatchState();
+    FScrewMatchLog& GetActiveMatchLog();
+
+    /** Builds the card catalog from CardDataTable, or shares the bound table's, if it does not exist yet */
+    bool EnsureCardCatalog();
+
+    /** Spawns pooled cards until the pool holds at least Count idle cards */
+    void PrewarmCardPool(int32 Count);
+
+    /** Takes an idle card from the pool, spawning a new one only if the pool is empty */
+    ACard* AcquireCardFromPool(const FTransform& Transform, AController* Controller);
+
+    /** Starts a new match with a fresh seed, an empty deck and a new match log, releasing the previous match's hands */
+    void BeginMatch();
+
+    /** GameMode login events feeding the seat registry */
+    void HandleGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+    void HandleGameModeLogout(AGameModeBase* GameMode, AController* Exiting);
+
+    /** Vacates the seat of a player that left the bound UScrewTableSubsystem table */
+    void HandleTablePlayerRemoved(int32 RemovedTableId, AController* Player, int32 Seat);
+
+    /** Makes the seat registry match the players of the bound UScrewTableSubsystem table, seat for seat */
+    void SyncSeatsWithTable();
+
+    /** Closes the gaps left by vacated seats, only called right before a deal since it renumbers seats */
+    void CompactSeatRegistry();
+
+    /** Puts a player in a specific seat of the registry and spawns its hand view */
+    void SeatPlayer(AController* Controller, int32 Seat);
+
+    /** Resolves every queued ability command and sends their reveals */
+    void FlushAbilityQueue();
+
+    /** Records that a seat has seen the card in a slot, replacing what it knew about that slot */
+    void RememberReveal(const FScrewCardReveal& Reveal);
+
+    /** Lets a seat see the card it just drew or was granted */
+    void RememberOwnNewestCard(int32 Seat);
+
+    /** Drops reveals of a card that left a hand and shifts reveals of the cards behind it */
+    void ForgetRemovedSlot(int32 Seat, int32 CardIndex);
+
+    /** Mirrors a resolved ability into the card actors of the affected hands */
+    void ApplyAbilityToHands(const FScrewAbilityCommand& Command);
+
+    /** Pushes hand sizes and every seat's visible cards to the replicated views */
+    void SyncHandViews();
+
+    UFUNCTION()
+    void OnRep_HandSizes();
+
+    UFUNCTION()
+    void OnRep_SeatTransforms();
+
+    UFUNCTION()
+    void HandleLocalKnownCardsChanged(const TArray<FScrewVisibleCard>& Cards);
+
+    /** Rebuilds the client instances from the replicated hand sizes and the local hand view */
+    void RefreshRemoteCardInstances();
+
+    /** Transform of a card in a seat's hand, the 2x2 deal grid continued row by row for extra cards */
+    FTransform GetHandSlotTransform(const FTransform& SeatTransform, int32 CardIndex) const;
+
+    /** Card id the local player has been shown for a dealt card, or INDEX_NONE */
+    int32 GetLocallyVisibleCardId(const ACard* Card) const;
+
+    /** Re-applies instance faces after the local player's reveals changed */
+    void RefreshCardInstances();
+
+    /** Moves the card's instance to the card actor, or hides it when the card is back in the pool */
+    void UpdateCardInstance(ACard* Card);
+
+    /** Releases every card currently held in player hands */
+    void ReleaseAllHands();
+
+    /** Spawns the actor for a catalog card and tags it with its card id */
+    ACard* SpawnCatalogCard(FScrewCardId CardId, const FTransform& Transform, AController* Controller);
+
+    /** Rules engine state for deck, discard pile, hands and turn order when no table is bound */
+    FScrewMatchState LocalMatchState;
+
+    /** Binary record of every rule step applied to LocalMatchState */
+    FScrewMatchLog LocalMatchLog;
+
+    /** Immutable card catalog built once from CardDataTable */
+    TSharedPtr<const FScrewCardCatalog> CardCatalog;
+
+    /** Instance of each card actor in CardInstances, a card keeps its instance while pooled */
+    TMap<ACard*, int32> CardInstanceIndices;
+
+    /** Idle card actors waiting to be reused */
     UPROPERTY()
-    TArray<FCardData> Deck;
+    TArray<ACard*> CardPool;
 
-    /** Hands for each player */
+    /** Hands for each seat, indexed like Controllers */
     UPROPERTY()
-    TMap<AController*, FPlayerHand> PlayerHands;
+    TArray<FPlayerHand> PlayerHands;
 
-    /** Array of connected Controllers */
+    /** Seat registry, the index is the seat and vacant seats are null */
     UPROPERTY()
     TArray<AController*> Controllers;
 
+    /** Controller to seat lookup for the registry */
+    TMap<AController*, int32> SeatIndices;
+
+    /** Ability commands waiting for the next flush */
+    TArray<FScrewAbilityCommand> AbilityQueue;
+
+    /** Scratch array reused by every flush */
+    TArray<FScrewCardReveal> PendingReveals;
+
+    /** Cards each seat has been shown, own or opponent, kept until the revealed slot changes */
+    TArray<FScrewCardReveal> KnownReveals;
+
+    /** Visible cards per seat, indexed like Controllers */
+    UPROPERTY()
+    TArray<AScrewHandView*> HandViews;
+
+    /** Client side: the local player's replicated view */
+    TWeakObjectPtr<AScrewHandView> LocalHandView;
+
+    FTimerHandle AbilityFlushHandle;
+
+    FDelegateHandle PostLoginHandle;
+    FDelegateHandle LogoutHandle;
+    FDelegateHandle TablePlayerRemovedHandle;
+
 };
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "Tasks/Task.h"
+#include "ScrewBotPlanner.h"
+#include "ScrewBotController.generated.h"
+
+class ACardManager;
+
+/**
+ * Bot that fills a seat at a ACardManager table.
+ * On its turn it snapshots the match state, plans with FScrewBotPlanner on a background task and
+ * applies the chosen move on the game thread once the task finishes, so planning never blocks the tick.
+ */
+UCLASS()
+class SCREW_API AScrewBotController : public AAIController
+{
+    GENERATED_BODY()
+
+public:
+    AScrewBotController();
+
+    virtual void Tick(float DeltaSeconds) override;
+
+    /** Seats the bot at the card manager's table */
+    UFUNCTION(BlueprintCallable, Category = "Screw Bot")
+    void JoinTable(ACardManager* InCardManager);
+
+    UFUNCTION(BlueprintCallable, Category = "Screw Bot")
+    void LeaveTable();
+
+    /** Wall clock time the bot may spend planning one move */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Screw Bot")
+    float MoveTimeBudget = 0.05f;
+
+    /** Search trees planned in parallel per move */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Screw Bot")
+    int32 ParallelTrees = 2;
+
+    /** Turns each playout looks ahead */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Screw Bot")
+    int32 PlayoutTurns = 8;
+
+    /** Ends the bot's turn after its move, disable when the game mode advances turns itself */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Screw Bot")
+    bool bAdvanceTurnAfterMove = true;
+
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Applies a planned move through the card manager */
+    void ExecuteMove(const FScrewBotMove& Move);
+
+    /** Picks targets for the abilities the bot's last play queued and hands them to the card manager */
+    void QueuePendingAbilities();
+
+    UPROPERTY(BlueprintReadOnly, Category = "Screw Bot")
+    ACardManager* CardManager;
+
+private:
+    /** Hand slots whose card the seat has been shown */
+    void GatherKnownSlots(int32 Seat, TArray<FScrewCardSlot>& OutSlots) const;
+
+    /** Planning task for the current turn, invalid while idle */
+    UE::Tasks::TTask<FScrewBotMove> PlanTask;
+
+    /** Turn the last plan was started for, so each turn is planned once */
+    int32 PlannedTurn = INDEX_NONE;
+};
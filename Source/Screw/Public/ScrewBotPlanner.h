@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScrewMatchState.h"
+
+/** What a seat does on its turn */
+enum class EScrewBotMoveType : uint8
+{
+    /** Draw the top card of the deck, GrantCardFromDeck on a live match */
+    Draw,
+    /** Play a card from the hand, PlayCard on a live match */
+    Play
+};
+
+struct FScrewBotMove
+{
+    EScrewBotMoveType Type = EScrewBotMoveType::Draw;
+
+    /** Hand index for Play */
+    int32 CardIndex = INDEX_NONE;
+
+    bool operator==(const FScrewBotMove& Other) const { return Type == Other.Type && CardIndex == Other.CardIndex; }
+};
+
+struct FScrewBotPlannerSettings
+{
+    /** Wall clock time a single decision may take */
+    double TimeBudgetSeconds = 0.05;
+
+    /** Independent search trees run in parallel and merged at the root */
+    int32 NumTrees = 2;
+
+    /** Iteration cap per tree, the search stops at whichever limit is hit first */
+    int32 MaxIterations = 20000;
+
+    /** Turns simulated past the root before a playout is scored */
+    int32 PlayoutTurns = 8;
+
+    /** UCB exploration constant */
+    float Exploration = 0.7f;
+};
+
+/**
+ * Information set Monte Carlo tree search over FScrewMatchState.
+ * Each iteration plays out one determinization of the hidden cards, so the tree only branches on
+ * what the planning seat can actually observe. Independent trees are searched on worker threads
+ * and their root visit counts summed. Plan works on its own copy of the state and is safe to run
+ * off the game thread.
+ */
+class SCREW_API FScrewBotPlanner
+{
+public:
+    /** Picks the move for Seat, which must be the seat whose turn it is. KnownSlots are the hand slots Seat has been shown */
+    static FScrewBotMove Plan(const FScrewMatchState& State, int32 Seat, TConstArrayView<FScrewCardSlot> KnownSlots, const FScrewBotPlannerSettings& Settings, int32 Seed);
+
+    static void GetLegalMoves(const FScrewMatchState& State, int32 Seat, TArray<FScrewBotMove>& OutMoves);
+
+    /** Applies the move for Seat, resolves the abilities it queued and passes the turn */
+    static void ApplyMove(FScrewMatchState& State, int32 Seat, const FScrewBotMove& Move, FRandomStream& Stream);
+
+    /** Picks targets for a pending ability, the command is left without targets when none are legal. State is read as if fully known, so outside a search pass a determinized copy */
+    static void MakeAbilityCommand(const FScrewMatchState& State, const FScrewPendingAbility& Pending, FRandomStream& Stream, FScrewAbilityCommand& OutCommand);
+};
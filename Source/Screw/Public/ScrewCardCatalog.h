@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Card.h"
+
+class UDataTable;
+
+/** Compact card identifier, indexes the rows of a FScrewCardCatalog */
+typedef uint16 FScrewCardId;
+
+/** Marks an empty or unknown card */
+static constexpr FScrewCardId ScrewInvalidCardId = MAX_uint16;
+
+/**
+ * Immutable card catalog built once from the card Data Table.
+ * Decks, hands and discard piles only store FScrewCardId; value and ability are looked up here
+ * from tightly packed arrays, and the full FCardData row is only touched when an actor needs it.
+ * A single catalog can be shared by any number of match states.
+ */
+class SCREW_API FScrewCardCatalog
+{
+public:
+    /** Builds a catalog from a Data Table with FCardData rows, returns nullptr if the table is invalid */
+    static TSharedPtr<const FScrewCardCatalog> Build(const UDataTable* CardDataTable);
+
+    /** Builds a catalog from card rows, each row contributes Quantity copies to the deck template */
+    explicit FScrewCardCatalog(const TArray<FCardData>& InRows);
+
+    bool IsValidId(FScrewCardId CardId) const { return CardId < Values.Num(); }
+    int32 Num() const { return Values.Num(); }
+
+    int32 GetValue(FScrewCardId CardId) const { return Values[CardId]; }
+    ECardAbility GetAbility(FScrewCardId CardId) const { return Abilities[CardId]; }
+
+    /** Full row data, for display only */
+    const FCardData& GetCardData(FScrewCardId CardId) const { return Rows[CardId]; }
+
+    /** Every physical card of a full deck, unshuffled */
+    const TArray<FScrewCardId>& GetDeckTemplate() const { return DeckTemplate; }
+
+    /** Finds the id of a row by card name, returns ScrewInvalidCardId if it is not part of the catalog */
+    FScrewCardId FindCardId(const FString& Name) const;
+
+private:
+    TArray<int32> Values;
+    TArray<ECardAbility> Abilities;
+    TArray<FScrewCardId> DeckTemplate;
+    TArray<FCardData> Rows;
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "ScrewMatchState.h"
+#include "ScrewHandView.generated.h"
+
+class AScrewHandView;
+class ACardManager;
+
+/** Card face a player is allowed to see */
+USTRUCT(BlueprintType)
+struct FScrewVisibleCard
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Card Data")
+    int32 Seat = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Card Data")
+    int32 CardIndex = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Card Data")
+    int32 CardId = INDEX_NONE;
+};
+
+/** One known hand slot, replicated as a fast array item so only changed slots are sent */
+USTRUCT()
+struct FScrewKnownCard : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint8 Seat = 0;
+
+    UPROPERTY()
+    uint8 CardIndex = 0;
+
+    UPROPERTY()
+    uint16 CardId = ScrewInvalidCardId;
+
+    void PreReplicatedRemove(const struct FScrewKnownCardArray& InArraySerializer);
+    void PostReplicatedAdd(const struct FScrewKnownCardArray& InArraySerializer);
+    void PostReplicatedChange(const struct FScrewKnownCardArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FScrewKnownCardArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FScrewKnownCard> Items;
+
+    /** View that owns the array, set on every machine */
+    UPROPERTY(NotReplicated)
+    TObjectPtr<AScrewHandView> View = nullptr;
+
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FScrewKnownCard, FScrewKnownCardArray>(Items, DeltaParms, *this);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FScrewKnownCardArray> : public TStructOpsTypeTraitsBase2<FScrewKnownCardArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScrewKnownCardsChanged, const TArray<FScrewVisibleCard>&, ChangedCards);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScrewKnownCardsRemoved, const TArray<FScrewVisibleCard>&, RemovedCards);
+
+/**
+ * Card faces one seat is entitled to see: the cards of any hand, its own included, that it has been shown.
+ * Spawned by ACardManager per seat, owned by the seated controller and only relevant to that owner,
+ * so face values never reach other clients. Everyone else only sees card backs through
+ * ACardManager::HandSizes.
+ */
+UCLASS(NotBlueprintable)
+class SCREW_API AScrewHandView : public AInfo
+{
+    GENERATED_BODY()
+
+public:
+    AScrewHandView();
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void PostInitializeComponents() override;
+
+    /** Server only: replaces the known cards, marking only the slots that changed */
+    void SetKnownCards(int32 InSeat, TConstArrayView<FScrewCardReveal> Cards);
+
+    UFUNCTION(BlueprintPure, Category = "Card Data")
+    int32 GetSeat() const { return Seat; }
+
+    /** Server only: the card manager whose table this view shows */
+    void SetCardManager(ACardManager* InCardManager) { CardManager = InCardManager; }
+
+    UFUNCTION(BlueprintPure, Category = "Card Data")
+    TArray<FScrewVisibleCard> GetKnownCards() const;
+
+    /** Fires on the owning machine with the slots added or changed by the last update */
+    UPROPERTY(BlueprintAssignable, Category = "Card Data")
+    FOnScrewKnownCardsChanged OnKnownCardsChanged;
+
+    /** Fires on the owning machine, before OnKnownCardsChanged, with the slots whose face must be hidden again */
+    UPROPERTY(BlueprintAssignable, Category = "Card Data")
+    FOnScrewKnownCardsRemoved OnKnownCardsRemoved;
+
+private:
+    friend struct FScrewKnownCard;
+    friend struct FScrewKnownCardArray;
+
+    void AddChangedCard(const FScrewKnownCard& Card);
+    void AddRemovedCard(const FScrewKnownCard& Card);
+    void BroadcastChangedCards();
+
+    UPROPERTY(Replicated)
+    FScrewKnownCardArray KnownCards;
+
+    UPROPERTY(Replicated)
+    int32 Seat = INDEX_NONE;
+
+    UPROPERTY(ReplicatedUsing = OnRep_CardManager)
+    TObjectPtr<ACardManager> CardManager;
+
+    UFUNCTION()
+    void OnRep_CardManager();
+
+    /** Slots changed since the last broadcast */
+    TArray<FScrewVisibleCard> ChangedCards;
+
+    /** Slots removed since the last broadcast */
+    TArray<FScrewVisibleCard> RemovedCards;
+};
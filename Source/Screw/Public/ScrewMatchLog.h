@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScrewMatchState.h"
+
+/** Event types stored in a FScrewMatchLog, values are part of the binary format */
+enum class EScrewMatchEvent : uint8
+{
+    /** Payload: int32 seed; clears the state, a log may hold several matches */
+    MatchStart = 0,
+    /** No payload */
+    InitializeDeck = 1,
+    /** No payload */
+    ShuffleDeck = 2,
+    /** Payload: uint8 seat count */
+    ResetSeats = 3,
+    /** Payload: uint8 seat, uint8 card count */
+    Deal = 4,
+    /** Payload: uint8 seat, uint16 card id */
+    Draw = 5,
+    /** Payload: uint8 seat, uint16 card id */
+    Grant = 6,
+    /** Payload: uint8 seat, uint8 hand index, uint16 card id */
+    Play = 7,
+    /** Payload: uint8 seat, uint8 ability */
+    Ability = 8,
+    /** Payload: uint8 seat that now has the turn */
+    AdvanceTurn = 9,
+    /** Payload: uint8 seat, uint8 hand index; one per target, written before the ResolveAbility it belongs to */
+    AbilityTarget = 10,
+    /** Payload: uint8 seat, uint8 ability */
+    ResolveAbility = 11,
+    /** Payload: uint8 seat whose player left the match */
+    SeatVacated = 12
+};
+
+/**
+ * Compact, append-only binary log of every rule step applied to a FScrewMatchState.
+ * Together with the seed in the MatchStart event it is enough to rebuild any turn of a match.
+ */
+class SCREW_API FScrewMatchLog
+{
+public:
+    static constexpr uint32 Magic = 0x57524353; // 'SCRW'
+    /** Version 2 added ability resolution, version 3 added vacated seats; older logs still load */
+    static constexpr uint8 Version = 3;
+
+    FScrewMatchLog();
+
+    /** Drops all events and writes a new header */
+    void Reset();
+
+    void LogMatchStart(int32 Seed);
+    void LogInitializeDeck();
+    void LogShuffleDeck();
+    void LogResetSeats(int32 NumSeats);
+    void LogDeal(int32 Seat, int32 Count);
+    void LogDraw(int32 Seat, FScrewCardId CardId);
+    void LogGrant(int32 Seat, FScrewCardId CardId);
+    void LogPlay(int32 Seat, int32 CardIndex, FScrewCardId CardId);
+    void LogAbility(int32 Seat, ECardAbility Ability);
+    void LogAdvanceTurn(int32 Seat);
+    void LogResolveAbility(const FScrewAbilityCommand& Command);
+    void LogSeatVacated(int32 Seat);
+
+    const TArray<uint8>& GetData() const { return Data; }
+    int32 GetNumEvents() const { return NumEvents; }
+
+    /** Replaces the log with previously saved bytes, returns false if the header does not match */
+    bool SetData(TArray<uint8>&& InData);
+
+    bool SaveToFile(const FString& FileName) const;
+    bool LoadFromFile(const FString& FileName);
+
+    /** Size of the header in bytes */
+    static constexpr int32 HeaderSize = sizeof(uint32) + sizeof(uint8);
+
+private:
+    void BeginEvent(EScrewMatchEvent Type);
+    void WriteUInt8(uint8 Value) { Data.Add(Value); }
+    void WriteUInt16(uint16 Value);
+    void WriteInt32(int32 Value);
+
+    TArray<uint8> Data;
+    int32 NumEvents;
+};
+
+/** Outcome of replaying a match log */
+enum class EScrewReplayResult : uint8
+{
+    Ok,
+    /** The log ended before the requested turn */
+    TurnNotReached,
+    /** The log is truncated or holds an unknown event */
+    Corrupt,
+    /** A rule step produced a different result than the one recorded */
+    Desync
+};
+
+/** Rebuilds a match state by re-applying the events of a FScrewMatchLog */
+class SCREW_API FScrewMatchReplay
+{
+public:
+    /**
+     * Replays the log into OutState, which must already use the same card catalog as the recorded match.
+     * Stops right after the event that starts turn StopAtTurn; pass INDEX_NONE to replay the whole log.
+     * OutEventIndex receives the index of the last applied event, or of the failing one on error.
+     */
+    static EScrewReplayResult Replay(const FScrewMatchLog& Log, FScrewMatchState& OutState, int32 StopAtTurn, int32& OutEventIndex);
+};
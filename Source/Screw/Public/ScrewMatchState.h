@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Card.h"
+#include "ScrewCardCatalog.h"
+
+/** Ability queued by a played card, waiting to be resolved */
+struct FScrewPendingAbility
+{
+    int32 Seat = INDEX_NONE;
+
+    ECardAbility Ability = ECardAbility::None;
+};
+
+/** One card in a seat's hand */
+struct FScrewCardSlot
+{
+    int32 Seat = INDEX_NONE;
+
+    int32 CardIndex = INDEX_NONE;
+
+    bool operator==(const FScrewCardSlot& Other) const { return Seat == Other.Seat && CardIndex == Other.CardIndex; }
+};
+
+/**
+ * Resolution of a pending ability chosen by the seat that played it.
+ * Target layout per ability:
+ *  Selection, RevealOpponentOne, RevealSelfOne, DiscardOneSelf: one card
+ *  SwapOneNoReveal, RevealOneAndSwap: own card, then opponent card
+ *  RevealOneEachOpponent: one card from every opponent holding cards
+ * An empty target list declines the ability.
+ */
+struct FScrewAbilityCommand
+{
+    int32 Seat = INDEX_NONE;
+
+    ECardAbility Ability = ECardAbility::None;
+
+    TArray<FScrewCardSlot, TInlineAllocator<4>> Targets;
+};
+
+/** A card shown to one seat by an ability */
+struct FScrewCardReveal
+{
+    int32 ViewerSeat = INDEX_NONE;
+
+    FScrewCardSlot Slot;
+
+    FScrewCardId CardId = ScrewInvalidCardId;
+};
+
+/** One seat at the table */
+struct FScrewSeat
+{
+    TArray<FScrewCardId> Hand;
+
+    /** The player left mid-match, the seat keeps its index and hand but no longer takes turns */
+    bool bVacant = false;
+};
+
+/** Outcome of a single rule step */
+enum class EScrewRuleResult : uint8
+{
+    Ok,
+    InvalidSeat,
+    InvalidCardIndex,
+    InvalidCard,
+    NotEnoughCards,
+    DeckEmpty,
+    NoPlayers,
+    NoPendingAbility,
+    InvalidTarget
+};
+
+/**
+ * Headless Screw match state.
+ * Holds the deck, discard pile, hands, turn order and pending abilities as plain data so rules
+ * can be simulated without a world. ACardManager drives it and mirrors the result into actors.
+ * Cards are FScrewCardId values into a shared, immutable FScrewCardCatalog.
+ */
+class SCREW_API FScrewMatchState
+{
+public:
+    FScrewMatchState();
+
+    /** Sets the catalog used to build the deck and look up card values and abilities */
+    void SetCatalog(const TSharedPtr<const FScrewCardCatalog>& InCatalog);
+
+    const FScrewCardCatalog* GetCatalog() const { return Catalog.Get(); }
+
+    /** Reseeds the match random stream, every shuffle after this is reproducible from the seed */
+    void SetSeed(int32 InSeed);
+
+    int32 GetSeed() const { return RandomStream.GetInitialSeed(); }
+
+    /** Starts a new match: reseeds the random stream and empties the deck, hands, discard pile, pending abilities and turn order */
+    void BeginMatch(int32 InSeed);
+
+    /** Appends a full deck from the catalog's deck template to any cards still in the deck */
+    void InitializeDeck();
+
+    /** Shuffles the deck in place using the match random stream */
+    bool ShuffleDeck();
+
+    /** Clears hands, discard pile, pending abilities and turn order and creates NumSeats empty seats */
+    void ResetSeats(int32 NumSeats);
+
+    /** Deals Count cards from the deck into the seat's hand */
+    EScrewRuleResult DealToSeat(int32 Seat, int32 Count);
+
+    /** Draws the top card of the deck into the seat's hand, regenerating the deck when it runs out */
+    EScrewRuleResult DrawCard(int32 Seat, FScrewCardId& OutCardId);
+
+    /** Adds a copy of an existing card to the seat's hand */
+    EScrewRuleResult GrantCard(int32 Seat, FScrewCardId CardId);
+
+    /** Moves a card from the seat's hand to the discard pile and queues its ability */
+    EScrewRuleResult PlayCard(int32 Seat, int32 CardIndex, FScrewCardId& OutCardId);
+
+    /** Moves the turn to the next occupied seat, passing over vacated seats within the same turn */
+    EScrewRuleResult AdvanceTurn();
+
+    /** Marks a seat as left by its player for the rest of the match */
+    EScrewRuleResult SetSeatVacant(int32 Seat);
+
+    /**
+     * Reshuffles every card the observer has not seen and deals them back into the same slots, producing
+     * one possible world consistent with what the observer knows. KnownSlots are the hand slots the observer
+     * has been shown, in its own hand or an opponent's; every other hand slot and the deck is resampled.
+     */
+    void Determinize(TConstArrayView<FScrewCardSlot> KnownSlots, FRandomStream& Stream);
+
+    /** Checks that the seat has the ability pending and that the targets fit the ability */
+    EScrewRuleResult ValidateAbility(const FScrewAbilityCommand& Command) const;
+
+    /** Validates and applies an ability, consuming its pending entry; cards shown to the caster are appended to OutReveals */
+    EScrewRuleResult ResolveAbility(const FScrewAbilityCommand& Command, TArray<FScrewCardReveal>& OutReveals);
+
+    /** Pops the oldest pending ability, returns false when none are queued */
+    bool PopPendingAbility(FScrewPendingAbility& OutAbility);
+
+    bool IsValidSeat(int32 Seat) const { return Seats.IsValidIndex(Seat); }
+    bool IsSeatVacant(int32 Seat) const { return IsValidSeat(Seat) && Seats[Seat].bVacant; }
+    int32 GetNumSeats() const { return Seats.Num(); }
+    int32 GetDeckNum() const { return Deck.Num(); }
+    int32 GetCurrentTurnSeat() const { return CurrentTurnSeat; }
+    int32 GetTurnCount() const { return TurnCount; }
+
+    const TArray<FScrewCardId>& GetHand(int32 Seat) const { return Seats[Seat].Hand; }
+    const TArray<FScrewCardId>& GetDeck() const { return Deck; }
+    const TArray<FScrewCardId>& GetDiscardPile() const { return DiscardPile; }
+    const TArray<FScrewPendingAbility>& GetPendingAbilities() const { return PendingAbilities; }
+
+    /** Sum of card values in the seat's hand */
+    int32 GetHandValue(int32 Seat) const;
+
+private:
+    bool IsValidSlot(const FScrewCardSlot& Slot) const { return IsValidSeat(Slot.Seat) && Seats[Slot.Seat].Hand.IsValidIndex(Slot.CardIndex); }
+    int32 FindPendingAbility(int32 Seat, ECardAbility Ability) const;
+
+    TSharedPtr<const FScrewCardCatalog> Catalog;
+
+    /** Per-match random stream, never the global FMath random state */
+    FRandomStream RandomStream;
+
+    TArray<FScrewCardId> Deck;
+    TArray<FScrewCardId> DiscardPile;
+    TArray<FScrewSeat> Seats;
+    TArray<FScrewPendingAbility> PendingAbilities;
+
+    int32 CurrentTurnSeat;
+    int32 TurnCount;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ScrewMatchState.h"
+#include "ScrewMatchLog.h"
+#include "ScrewTableSubsystem.generated.h"
+
+class AController;
+class UDataTable;
+
+/** One independent match hosted by UScrewTableSubsystem */
+struct FScrewTable
+{
+    FScrewMatchState State;
+    FScrewMatchLog Log;
+
+    /** Seated players, seat index is the array index. A player leaving clears its slot so nobody else changes seat mid-match */
+    TArray<TWeakObjectPtr<AController>> Players;
+
+    /** Seed of every match at this table, 0 picks a new random seed per match */
+    int32 Seed = 0;
+
+    /** Drops cleared and stale player slots, only call between matches since it renumbers seats */
+    void CompactSeats();
+};
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnScrewTablePlayerRemoved, int32 /*TableId*/, AController* /*Player*/, int32 /*Seat*/);
+
+/**
+ * Hosts any number of independent Screw tables in one world.
+ * Each table owns its own match state, log and player set. The subsystem only hosts them: the ACardManager
+ * bound to a table is the one place rule steps are applied, starting with a freshly built deck every match.
+ */
+UCLASS()
+class SCREW_API UScrewTableSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin UWorldSubsystem Interface
+    virtual void Deinitialize() override;
+    //~ End UWorldSubsystem Interface
+
+    /** Creates a table dealing from CardDataTable, returns its id or INDEX_NONE on failure. Seed 0 picks a random seed per match */
+    UFUNCTION(BlueprintCallable, Category = "Screw Tables")
+    int32 CreateTable(UDataTable* CardDataTable, int32 Seed);
+
+    UFUNCTION(BlueprintCallable, Category = "Screw Tables")
+    void DestroyTable(int32 TableId);
+
+    /** Seats a player at a table, a player can only sit at one table at a time. Seats of the running match are never reused */
+    UFUNCTION(BlueprintCallable, Category = "Screw Tables")
+    bool AddPlayerToTable(int32 TableId, AController* Player);
+
+    UFUNCTION(BlueprintCallable, Category = "Screw Tables")
+    void RemovePlayer(AController* Player);
+
+    /** Returns the table the player sits at, or INDEX_NONE */
+    UFUNCTION(BlueprintPure, Category = "Screw Tables")
+    int32 GetTableForPlayer(AController* Player) const;
+
+    UFUNCTION(BlueprintPure, Category = "Screw Tables")
+    TArray<AController*> GetTablePlayers(int32 TableId) const;
+
+    UFUNCTION(BlueprintPure, Category = "Screw Tables")
+    int32 GetNumTables() const { return Tables.Num(); }
+
+    const FScrewTable* FindTable(int32 TableId) const;
+    FScrewTable* FindTable(int32 TableId);
+
+    /** Broadcast after a player left a table, the bound ACardManager vacates the seat in the running match */
+    FOnScrewTablePlayerRemoved OnTablePlayerRemoved;
+
+private:
+    /** Returns the shared catalog for a Data Table, building it on first use */
+    TSharedPtr<const FScrewCardCatalog> GetCatalog(UDataTable* CardDataTable);
+
+    /** Hosted tables by id, ids are never reused so a stale id cannot address a newer table */
+    TMap<int32, FScrewTable> Tables;
+
+    int32 NextTableId = 0;
+
+    /** Player to table id */
+    TMap<TWeakObjectPtr<AController>, int32> PlayerTables;
+
+    /** One catalog per card Data Table, shared by every table that uses it */
+    TMap<TWeakObjectPtr<UDataTable>, TSharedPtr<const FScrewCardCatalog>> Catalogs;
+};
@@ -8,7 +8,7 @@ public class Screw : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 	
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "SteamCorePro" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "NetCore", "AIModule", "SteamCorePro" });
 
 		PrivateDependencyModuleNames.AddRange(new string[] {  });
 